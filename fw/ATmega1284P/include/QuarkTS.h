@@ -62,6 +62,22 @@ Download the user manual here : https://github.com/TECREA/QuarkTS/blob/master/qu
         #include "qbsbuffers.h"
     #endif
 
+    #if ( Q_COBS_FRAMING == 1 )
+        #include "qcobs.h"
+    #endif
+
+    #if ( Q_CALLBACK_TIMERS == 1 )
+        #include "qctimers.h"
+    #endif
+
+    #if ( Q_CHANNELS == 1 )
+        #include "qchannels.h"
+    #endif
+
+    #if ( Q_CRC == 1 )
+        #include "qcrc.h"
+    #endif
+
     #include "qflm.h"
 
 
@@ -89,6 +105,10 @@ Download the user manual here : https://github.com/TECREA/QuarkTS/blob/master/qu
         #warning Disposing standard types can cause portability issues and undefined behaviors. QuarkTS produce similar definitions based on the common sizes of native types, however, this sizes can vary because they are implementation-defined  across different compilers. Use this setting at your own risk.
     #endif
 
+    #if ( ( Q_SETUP_TIME_CANONICAL != 1 ) && ( Q_SETUP_TIME_FIXEDPOINT == 1 ) && ( Q_SETUP_TICK_IN_HERTZ != 1 ) )
+        #error Q_SETUP_TIME_FIXEDPOINT requires the timing base in Hertz, enable Q_SETUP_TICK_IN_HERTZ.
+    #endif
+
     #if ( Q_FSM_MAX_NEST_DEPTH < 1 )
         #error Q_FSM_MAX_NEST_DEPTH must be defined to be greater than or equal to 1.
     #endif
@@ -97,6 +117,42 @@ Download the user manual here : https://github.com/TECREA/QuarkTS/blob/master/qu
         #error Q_FSM_MAX_TIMEOUTS must be defined with a value between 1 to 10.
     #endif
 
+    #if ( Q_MAX_FTOA_PRECISION > 12 )
+        #error Q_MAX_FTOA_PRECISION must be defined with a value between 0 to 12.
+    #endif
+
+    #if ( Q_CPU_LOAD_MONITOR == 1 )
+        #if ( Q_CLOCK_EXTENDED != 1 )
+            #error Q_CPU_LOAD_MONITOR requires Q_CLOCK_EXTENDED to be enabled.
+        #endif
+        #if ( Q_CPU_LOAD_WINDOW < 1 )
+            #error Q_CPU_LOAD_WINDOW must be defined to be greater than or equal to 1.
+        #endif
+        #if ( ( Q_CPU_LOAD_SLOT_EPOCHS < 1 ) || ( Q_CPU_LOAD_SLOT_EPOCHS > 65535 ) )
+            #error Q_CPU_LOAD_SLOT_EPOCHS must be defined with a value between 1 to 65535.
+        #endif
+    #endif
+
+    #if ( ( Q_COBS_FRAMING == 1 ) && ( Q_BYTE_SIZED_BUFFERS == 0 ) )
+        #error Q_COBS_FRAMING requires Q_BYTE_SIZED_BUFFERS to be enabled.
+    #endif
+
+    #if ( ( Q_NOTIFICATION_TOPICS < 0 ) || ( Q_NOTIFICATION_TOPICS > 32 ) )
+        #error Q_NOTIFICATION_TOPICS must be defined with a value between 0 to 32.
+    #endif
+
+    #if ( ( Q_NOTIFICATION_TOPICS > 0 ) && ( Q_NOTIFICATION_SPREADER == 0 ) )
+        #error Q_NOTIFICATION_TOPICS requires Q_NOTIFICATION_SPREADER to be enabled.
+    #endif
+
+    #if ( ( Q_CHANNELS == 1 ) && ( Q_QUEUES == 0 ) )
+        #error Q_CHANNELS requires Q_QUEUES to be enabled.
+    #endif
+
+    #if ( ( Q_CRC == 1 ) && ( ( Q_CRC_MODE < 0 ) || ( Q_CRC_MODE > 3 ) ) )
+        #error Q_CRC_MODE must be defined with a value between 0 to 3.
+    #endif
+
     #ifndef Q_TASK_EVENT_FLAGS
         #define Q_TASK_EVENT_FLAGS  ( 1 )
     #endif
@@ -0,0 +1,113 @@
+/*This file is part of the QuarkTS distribution.*/
+#ifndef QCHANNELS_H
+    #define QCHANNELS_H
+
+    #include "qtypes.h"
+    #include "qqueues.h"
+    #include "qtasks.h"
+    #include "qcoroutine.h"
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    /* Please don't access any members of this structure directly */
+    typedef struct{
+        struct _qChannel_Private_s{
+            qQueue_t Queue;                 /*< The bounded storage of the items in transit. */
+        }qPrivate;
+    }qChannel_t;
+
+    #define QCHANNEL_SELECT_NONE            ( -1 )
+
+    /*qBool_t qChannel_SetupFromArray( qChannel_t * const ch, Type Storage[] )
+
+    Initialize a channel over a typed array. The item size and the channel
+    capacity are taken from the array declaration.
+
+    Parameters:
+
+        - ch : A pointer to the channel object.
+        - Storage : The array used as the channel storage (not a pointer).
+
+    Return value:
+
+        Returns qTrue on success, otherwise returns qFalse;
+    */
+    #define qChannel_SetupFromArray( _ch_, _Storage_ )  qChannel_Setup( (_ch_), (void*)(_Storage_), sizeof( (_Storage_)[0] ), sizeof( _Storage_ )/sizeof( (_Storage_)[0] ) )
+
+    qBool_t qChannel_Setup( qChannel_t * const ch, void *Storage, const size_t ItemSize, const size_t Capacity );
+    qBool_t qChannel_TrySend( qChannel_t * const ch, void *Item );
+    qBool_t qChannel_TryReceive( qChannel_t * const ch, void *dest );
+    qBase_t qChannel_Select( qChannel_t * const * const Channels, const size_t Count, void *dest );
+    size_t qChannel_Count( const qChannel_t * const ch );
+    qQueue_t* qChannel_Get_Queue( qChannel_t * const ch );
+
+    #if ( Q_COROUTINE_WAITS == 1 )
+        #define _qCR_ChannelSend( _ch_, _Item_, _timeout_ )     _qCR_wu_Block( qChannel_TrySend( (_ch_), (_Item_) ), qChannel_Get_Queue( (_ch_) ), 0uL, qTrue, (_timeout_) )
+        #define _qCR_ChannelReceive( _ch_, _dest_, _timeout_ )  _qCR_wu_Block( qChannel_TryReceive( (_ch_), (_dest_) ), qChannel_Get_Queue( (_ch_) ), 0uL, qFalse, (_timeout_) )
+    #else
+        #define _qCR_ChannelSend( _ch_, _Item_, _timeout_ )     _qCR_wu_TmrAssert( qChannel_TrySend( (_ch_), (_Item_) ), (_timeout_) )
+        #define _qCR_ChannelReceive( _ch_, _dest_, _timeout_ )  _qCR_wu_TmrAssert( qChannel_TryReceive( (_ch_), (_dest_) ), (_timeout_) )
+    #endif
+
+    /*qCR_ChannelSend( qChannel_t * const ch, void *Item, qTime_t timeout )
+
+    Sends an item through the channel from a coroutine. If the channel is full,
+    the coroutine yields until there is room for the item or the <timeout>
+    expires. With Q_COROUTINE_WAITS enabled, the task is not dispatched while
+    waiting for room.
+
+    Parameters:
+
+        - ch : A pointer to the channel object.
+        - Item : A pointer to the item to send (copied to the channel).
+        - timeout : The maximum amount of time (In seconds) to wait.
+                    A qTimeImmediate value waits without a timeout.
+
+        > Note : Use <qCR_TimeoutExpired> after the statement to check if
+                 the item was not sent.
+    */
+    #define qCR_ChannelSend( _ch_, _Item_, _timeout_ )      _qCR_ChannelSend( _ch_, _Item_, _timeout_ )
+    /*qCR_ChannelReceive( qChannel_t * const ch, void *dest, qTime_t timeout )
+
+    Receives an item from the channel in a coroutine. If the channel is empty,
+    the coroutine yields until an item arrives or the <timeout> expires. With
+    Q_COROUTINE_WAITS enabled, the task is not dispatched while waiting.
+
+    Parameters:
+
+        - ch : A pointer to the channel object.
+        - dest : Pointer to the buffer into which the received item will be copied.
+        - timeout : The maximum amount of time (In seconds) to wait.
+                    A qTimeImmediate value waits without a timeout.
+
+        > Note : Use <qCR_TimeoutExpired> after the statement to check if
+                 nothing was received.
+    */
+    #define qCR_ChannelReceive( _ch_, _dest_, _timeout_ )   _qCR_ChannelReceive( _ch_, _dest_, _timeout_ )
+    /*qCR_ChannelSelect( qChannel_t * const * const Channels, size_t Count, void *dest, qBase_t Index, qTime_t timeout )
+
+    Receives an item from the first channel of the list that has one available.
+    The coroutine yields until any of the channels gets an item or the <timeout>
+    expires. The index of the source channel is written to <Index>
+    (QCHANNEL_SELECT_NONE on timeout).
+
+    Parameters:
+
+        - Channels : An array of pointers to the channels. The array order
+                     defines the precedence when several channels are ready.
+        - Count : The number of channels in the array.
+        - dest : Pointer to the buffer into which the received item will be
+                 copied. Must hold the largest item of the channels.
+        - Index : A qBase_t variable to store the index of the source channel.
+        - timeout : The maximum amount of time (In seconds) to wait.
+                    A qTimeImmediate value waits without a timeout.
+    */
+    #define qCR_ChannelSelect( _Channels_, _Count_, _dest_, _Index_, _timeout_ )   _qCR_wu_TmrAssert( ( QCHANNEL_SELECT_NONE != ( (_Index_) = qChannel_Select( (_Channels_), (_Count_), (_dest_) ) ) ), (_timeout_) )
+
+    #ifdef __cplusplus
+    }
+    #endif
+
+#endif
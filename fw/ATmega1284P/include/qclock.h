@@ -15,6 +15,18 @@
         #define QTUNIT_HOUR       ( 3600000uL )
         #define QTUNIT_DAY        ( 86400000uL )
         #define QTUNIT_WEEK       ( 604800000uL )           
+        #define qTime_Seconds( _xSeconds_ )         ( (qTime_t)( ( (_xSeconds_)*1000.0 ) + 0.5 ) )
+        #define qTime_Millis( _xMillis_ )           ( (qTime_t)( _xMillis_ ) )
+    #elif ( Q_SETUP_TIME_FIXEDPOINT == 1 )
+        typedef qUINT32_t qTime_t;  /*unsigned Q16.16 : seconds in the upper half, fraction in the lower half*/
+        #define QTIME_FRACTION_BITS ( 16 )
+        #define qTimeImmediate    ( (qTime_t)(0uL) )
+        #define QTUNIT_MINUTE     ( 60uL )    
+        #define QTUNIT_HOUR       ( 3600uL )
+        /*QTUNIT_DAY and QTUNIT_WEEK are not available : Q16.16 holds up to 65535 seconds*/
+        /*use them with constant arguments, so the conversion gets folded at compile time*/
+        #define qTime_Seconds( _xSeconds_ )         ( (qTime_t)( ( (_xSeconds_)*65536.0 ) + 0.5 ) )
+        #define qTime_Millis( _xMillis_ )           ( (qTime_t)( ( (_xMillis_)*65.536 ) + 0.5 ) )
     #else
         typedef qFloat32_t qTime_t;
         #define qTimeImmediate    ((qTime_t)(0.0f))
@@ -22,9 +34,15 @@
         #define QTUNIT_HOUR       ( 3600.0f )
         #define QTUNIT_DAY        ( 86400.0f )
         #define QTUNIT_WEEK       ( 604800.0f )       
+        #define qTime_Seconds( _xSeconds_ )         ( (qTime_t)( _xSeconds_ ) )
+        #define qTime_Millis( _xMillis_ )           ( (qTime_t)( (_xMillis_)*0.001 ) )
     #endif
 
-    #define QTUNIT_TOTIME( _xTime_ , _qUnit_ )      ( (qTime_t)( _xTime_ ) *  (qTime_t)( _qUnit_ ) )
+    #if ( ( Q_SETUP_TIME_CANONICAL != 1 ) && ( Q_SETUP_TIME_FIXEDPOINT == 1 ) )
+        #define QTUNIT_TOTIME( _xTime_ , _qUnit_ )  qTime_Seconds( (_xTime_)*(_qUnit_) )
+    #else
+        #define QTUNIT_TOTIME( _xTime_ , _qUnit_ )  ( (qTime_t)( _xTime_ ) *  (qTime_t)( _qUnit_ ) )
+    #endif
 
     #if ( Q_SETUP_TICK_IN_HERTZ == 1 )
         #define qTimingBase_t    qClock_t
@@ -44,6 +62,14 @@
     extern qGetTickFcn_t qClock_GetTick;
     qBool_t qClock_TimeDeadlineCheck( const qClock_t ti, const qClock_t td );
 
+    #if ( Q_CLOCK_EXTENDED == 1 )
+        typedef qUINT32_t (*qClock_SubTickFcn_t)( void );
+
+        qUINT64_t qClock_GetEpoch64( void );
+        void qClock_SetSubTickProvider( const qClock_SubTickFcn_t Provider, const qUINT32_t Resolution );
+        qUINT64_t qClock_GetTimestamp( void );
+    #endif
+
     #ifdef __cplusplus
     }
     #endif
@@ -0,0 +1,40 @@
+/*This file is part of the QuarkTS distribution.*/
+#ifndef QCOBS_H
+    #define QCOBS_H
+
+    #include "qtypes.h"
+    #include "qbsbuffers.h"
+    #include "qtasks.h"
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    /* Please don't access any members of this structure directly */
+    typedef struct{
+        struct _qCOBS_Receiver_Private_s{
+            qBSBuffer_t Buffer;             /*< The encoded bytes, frames are kept with their delimiter. */
+            qTask_t *Consumer;              /*< The task notified when a complete frame arrives. */
+            volatile qIndex_t FrameStart;   /*< The buffer head when the frame being received started. */
+            volatile qIndex_t Frames;       /*< The number of complete frames inside the buffer. */
+            volatile qIndex_t Dropped;      /*< The number of frames discarded by an overflow. */
+            volatile qBool_t Discard;       /*< Skip the incoming bytes until the next delimiter. */
+        }qPrivate;
+    }qCOBS_Receiver_t;
+
+    #define QCOBS_DELIMITER                 ( 0x00u )
+    /*Worst-case encoded size of a n bytes payload including the delimiter*/
+    #define QCOBS_ENCODED_MAX( n )          ( (size_t)(n) + ( (size_t)(n)/254u ) + 2u )
+
+    qBool_t qCOBS_Receiver_Setup( qCOBS_Receiver_t * const rx, volatile qUINT8_t *Storage, const size_t Size, qTask_t * const Consumer );
+    qBool_t qCOBS_Receiver_ISRHandler( qCOBS_Receiver_t * const rx, const qUINT8_t Byte );
+    size_t qCOBS_Receiver_Frames( const qCOBS_Receiver_t * const rx );
+    size_t qCOBS_Receiver_Dropped( const qCOBS_Receiver_t * const rx );
+    size_t qCOBS_Read( qCOBS_Receiver_t * const rx, void *dest, const size_t MaxLength );
+    qBool_t qCOBS_Write( qBSBuffer_t * const tx, const void *Data, const size_t n );
+
+    #ifdef __cplusplus
+    }
+    #endif
+
+#endif
@@ -5,28 +5,44 @@
     /*==================================================  CONFIGURATION FLAGS  =======================================================*/
     #define Q_PRIORITY_LEVELS           ( 3 )       /*< The number of priorities available to the application tasks*/
     #define Q_SETUP_TIME_CANONICAL      ( 0 )       /*< If enabled, kernel asumes the timing Base to 1mS(1KHz). All time specifications for tasks and STimers must be set in mS*/
-    #define Q_SETUP_TICK_IN_HERTZ       ( 0 )       /*< If enabled, the timming base will be taken as frequency(Hz) instead of period(S)*/
+    #define Q_SETUP_TICK_IN_HERTZ       ( 1 )       /*< If enabled, the timming base will be taken as frequency(Hz) instead of period(S)*/
+    #define Q_SETUP_TIME_FIXEDPOINT     ( 1 )       /*< If enabled, time is specified in unsigned Q16.16 seconds (see qTime_Seconds) and conversions are integer-only. Requires Q_SETUP_TICK_IN_HERTZ*/
+    #define Q_CLOCK_EXTENDED            ( 1 )       /*< Used to enable or disable the 64-bit monotonic epoch and the high-resolution timestamps*/
     #define Q_PRIO_QUEUE_SIZE           ( 10 )      /*< The size of the priority queue (use a 0(zero) value to disable it)*/    
     #define Q_PRESERVE_TASK_ENTRY_ORDER ( 0 )       /*< If enabled, kernel will preserve the tasks entry order every OS scheduling cycle*/
+    #define Q_SCHEDULER_EDF             ( 0 )       /*< If enabled, ready tasks are dispatched in Earliest-Deadline-First order instead of fixed priorities*/
+    #define Q_TASK_DEADLINE_MONITOR     ( 1 )       /*< Used to enable or disable the task deadline-miss detection and the fixed-rate rescheduling*/
     #define Q_MEMORY_MANAGER            ( 1 )       /*< Used to enable or disable the Memory Manager*/
     #define Q_BYTE_ALIGNMENT            ( 8 )       /*< Byte alignment used by the memory manager*/
     #define Q_DEFAULT_HEAP_SIZE         ( 512  )    /*< The default heap size for the memory manager*/    
     #define Q_NOTIFICATION_SPREADER     ( 1 )       /*< Used to enable or disable the spread notification functionality*/ 
+    #define Q_NOTIFICATION_TOPICS       ( 8 )       /*< The number of topics to spread notifications among subscribed tasks (use a 0(zero) value to disable them)*/
     #define Q_FSM                       ( 1 )       /*< Used to enable or disable the Finite State Machine (FSM) module */
     #define Q_FSM_MAX_NEST_DEPTH        ( 5 )       /*< The max depth of nesting in Finite State Machines (FSM)*/
     #define Q_QUEUES                    ( 1 )       /*< Used to enable or disable the qQueues*/
+    #define Q_CHANNELS                  ( 1 )       /*< Used to enable or disable the channels for message passing between coroutines and tasks (requires Q_QUEUES)*/
     #define Q_TRACE_VARIABLES           ( 1 )       /*< Used to enable or disable variable tracing and debuggin*/
     #define Q_DEBUGTRACE_BUFSIZE        ( 36 )      /*< Size for the debug/trace buffer: 36 bytes should be enough*/
     #define Q_DEBUGTRACE_FULL           ( 1 )       /*< Used to enable or disable a full trace output*/
     #define Q_ATCLI                     ( 1 )       /*< Used to enable or disable the AT Command Line Interface(CLI)*/
     #define Q_TASK_COUNT_CYCLES         ( 1 )       /*< Used to enable or disable the task cycles counter*/
     #define Q_TASK_EVENT_FLAGS          ( 1 )
+    #define Q_TASK_MAILBOX              ( 1 )       /*< Used to enable or disable the multi-slot notification mailboxes of the tasks*/
+    #define Q_COROUTINE_WAITS           ( 1 )       /*< Used to enable or disable the coroutine blocking waits on queues, notifications and event-flags*/
+    #define Q_CPU_LOAD_MONITOR          ( 1 )       /*< Used to enable or disable the CPU load accounting (requires Q_CLOCK_EXTENDED, set a sub-tick provider for accurate results)*/
+    #define Q_CPU_LOAD_WINDOW           ( 8 )       /*< The number of slots of the CPU load sliding window*/
+    #define Q_CPU_LOAD_SLOT_EPOCHS      ( 125 )     /*< The length of every slot of the CPU load sliding window in epochs*/
     #define Q_MAX_FTOA_PRECISION        ( 10u )     /*< default qFtoA precision*/
     #define Q_ATOF_FULL                 ( 0 )       /*< Used to enable or disablethe extended "e" notation parsing in qAtoF*/
+    #define Q_IOUTIL_SWAR               ( 1 )       /*< Used to enable or disable the word-at-a-time scanning of qIOUtil_BufStrLen and qIOUtil_BufStrChr on 32/64-bit cores*/
     #define Q_ALLOW_SCHEDULER_RELEASE   ( 1 )       /*< Used to enable or disable the release of the scheduling */
     #define Q_RESPONSE_HANDLER          ( 1 )       /*< Used to enable or disable the response handler*/
     #define Q_EDGE_CHECK_IOGROUPS       ( 1 )       /*< Used to enable or disable the edge check for I/O groups*/
     #define Q_BYTE_SIZED_BUFFERS        ( 1 )       /*< Used to enable or disable the Byte-sized buffers*/    
+    #define Q_COBS_FRAMING              ( 1 )       /*< Used to enable or disable the COBS framing layer over the Byte-sized buffers*/
+    #define Q_CRC                       ( 1 )       /*< Used to enable or disable the CRC module*/
+    #define Q_CRC_MODE                  ( 1 )       /*< The CRC implementation : 0-Bitwise(smallest), 1-Nibble table, 2-Byte table, 3-Slice-by-8(32-bit cores, CRC-32 only)*/
+    #define Q_CALLBACK_TIMERS           ( 1 )       /*< Used to enable or disable the callback timers service*/
     #define Q_USE_STDINT_H              ( 1 )       /*< Use the stdint.h header to define kernel data-types */
     #define Q_FSM_MAX_TIMEOUTS          ( 3 )    
 
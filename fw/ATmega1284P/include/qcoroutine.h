@@ -5,6 +5,10 @@
     #include "qtypes.h"
     #include "qstimers.h"
 
+    #if ( Q_COROUTINE_WAITS == 1 )
+        #include "qtasks.h"
+    #endif
+
     #ifdef __cplusplus
     extern "C" {
     #endif
@@ -20,9 +24,12 @@
         qSTimer_t crdelay;      /*< Used to hold the required delay for qCR_Delay. */
     }_qCR_Instance_t;
 
+    typedef _qCR_Instance_t qCR_Instance_t;
     typedef _qCR_Instance_t *qCR_Handle_t;
     typedef struct { size_t count; } qCR_Semaphore_t; 
     
+    #define QCR_INSTANCE_INITIALIZER    { _qCR_PC_INITVAL, _qCR_UNDEFINED, QSTIMER_INITIALIZER }
+
     #define QCR_RESTART     ( 0 )
     #define QCR_POSITIONSET ( 1 )
     #define QCR_SUSPEND     ( 2 )
@@ -46,15 +53,16 @@
     /*Construction stataments*/
     #define _qCR_CodeStartBlock        do
     #define _qCR_CodeEndBlock          while(qFalse)
-    #define _qCR_Persistent            static _qCR_Instance_t
+    #define _qCR_Persistent            static _qCR_Instance_t _qCRTaskStorage_ = QCR_INSTANCE_INITIALIZER
     #define _qCR_TaskProgress          __LINE__
     #define _qCR_Assert(_COND_)        if(!(_COND_))
-    #define _qCR_TaskPCVar             _qCRTaskState_.instr
-    #define _qCR_DelayVar              _qCRTaskState_.crdelay           
+    #define _qCR_TaskPCVar             _qCRTaskState_->instr
+    #define _qCR_DelayVar              _qCRTaskState_->crdelay           
     #define _qCR_SetPC(_VAL_)          _qCR_TaskPCVar = (_VAL_) 
     #define _qCR_SaveState             _qCR_SetPC(_qCR_TaskProgress) 
     #define _qCR_SaveStateOn(_VAR_)    ( _VAR_)  =  _qCR_TaskProgress
-    #define _qCR_InitState             _qCRTaskState_ = { _qCR_PC_INITVAL, _qCR_UNDEFINED, QSTIMER_INITIALIZER }
+    #define _qCR_InitState             _qCR_Instance_t * const _qCRTaskState_ = &_qCRTaskStorage_
+    #define _qCR_BindState(_inst_)     _qCR_Instance_t * const _qCRTaskState_ = (_inst_)
     #define _qCR_TaskCheckPCJump(_PC_) switch(_PC_){    
     #define _qCR_TagExitCCR            _qCRYield_ExitLabel
     #define _qCR_Exit                  goto _qCR_TagExitCCR /*MISRAC deviation*/
@@ -64,13 +72,15 @@
     #define _qCR_SuspendPoint          default: _qCR_Exit
     #define _qCR_RestoreAfterYield     _qCR_Restorator(_qCR_TaskProgress)
     #define _qCR_RestoreFromBegin      _qCR_Restorator(_qCR_PC_INITVAL)
-    #define _qCR_CatchHandle(h)        if( NULL == (h) ){ (h) = &_qCRTaskState_; }
+    #define _qCR_RestoreFromZeroed     _qCR_Restorator(_qCR_UNDEFINED)
+    #define _qCR_CatchHandle(h)        if( NULL == (h) ){ (h) = _qCRTaskState_; }
 
     /*Core Statements*/
     #define qCR_TimeoutSet(_timeout_)               qSTimer_Set( &_qCR_DelayVar, _timeout_ )    
     #define qCR_TimeoutExpired( )                   qSTimer_Expired( &_qCR_DelayVar )
-    #define _qCR_Start                              _qCR_Persistent  _qCR_InitState ; _qCR_TaskCheckPCJump(_qCR_TaskPCVar) _qCR_RestoreFromBegin
-    #define _qCR_hStart(h)                          _qCR_Persistent  _qCR_InitState ; _qCR_CatchHandle(h)   _qCR_TaskCheckPCJump(_qCR_TaskPCVar) _qCR_SuspendPoint; _qCR_RestoreFromBegin
+    #define _qCR_Start                              _qCR_Persistent ; _qCR_InitState ; _qCR_TaskCheckPCJump(_qCR_TaskPCVar) _qCR_RestoreFromBegin
+    #define _qCR_hStart(h)                          _qCR_Persistent ; _qCR_InitState ; _qCR_CatchHandle(h)   _qCR_TaskCheckPCJump(_qCR_TaskPCVar) _qCR_SuspendPoint; _qCR_RestoreFromBegin
+    #define _qCR_iStart(_inst_)                     _qCR_BindState(_inst_) ;              _qCR_TaskCheckPCJump(_qCR_TaskPCVar) _qCR_SuspendPoint; _qCR_RestoreFromZeroed _qCR_RestoreFromBegin
     #define _qCR_Yield                              _qCR_CodeStartBlock{ _qCR_SaveState              ; _qCR_TaskYield  _qCR_RestoreAfterYield; }                      _qCR_CodeEndBlock
     #define _qCR_Restart                            _qCR_CodeStartBlock{ _qCR_SetPC(_qCR_PC_INITVAL) ; _qCR_TaskYield }                                               _qCR_CodeEndBlock
     #define _qCR_wu_Assert(_cond_)                  _qCR_CodeStartBlock{ _qCR_SaveState              ; _qCR_RestoreAfterYield ; _qCR_Assert(_cond_) _qCR_TaskYield }  _qCR_CodeEndBlock
@@ -82,6 +92,8 @@
     #define _qCR_until( _cond_ )                    _qCR_Assert(_cond_) _qCR_TaskYield }  _qCR_CodeEndBlock     
     #define _qCR_PositionReset(_pos_)               (_pos_) = _qCR_PC_INITVAL
     #define _qCR_wu_preAssert(_pre_ , _cond_)       _qCR_do{ (_pre_); }_qCR_until((_cond_))                            
+    #define _qCR_wu_Block(_cond_, _q_, _f_, _all_, _timeout_)   _qCR_CodeStartBlock{ qCR_TimeoutSet(_timeout_)   ; _qCR_SaveState         ; _qCR_RestoreAfterYield    ; _qCR_Assert( _qCR_WaitRelease( (_cond_), &_qCR_DelayVar ) ){ _qCR_WaitBlock( (_q_), (_f_), (_all_), &_qCR_DelayVar ); _qCR_TaskYield } }  _qCR_CodeEndBlock
+    #define _qCR_wu_BlockFirst(_cond_, _timeout_)               _qCR_CodeStartBlock{ qCR_TimeoutSet(_timeout_)   ; _qCR_WaitBlock( NULL, 0uL, qFalse, &_qCR_DelayVar ); _qCR_SaveState; _qCR_TaskYield _qCR_RestoreAfterYield; _qCR_Assert( _qCR_WaitRelease( (_cond_), &_qCR_DelayVar ) ){ _qCR_WaitBlock( NULL, 0uL, qFalse, &_qCR_DelayVar ); _qCR_TaskYield } }  _qCR_CodeEndBlock
 
 
     /*qCR_Begin{
@@ -109,6 +121,24 @@
 
     */   
     #define qCR_BeginWithHandle( handle )                   _qCR_hStart( handle )
+    /*qCR_BeginWithInstance( qCR_Instance_t *instance ){
+    
+    }qCR_End;
+    
+    Defines a Coroutine segment whose state lives in the supplied <instance> 
+    instead of a function-local static. The same coroutine body can then serve 
+    several objects (one instance for every UART, sensor...), usually by 
+    embedding the qCR_Instance_t inside the structure passed as the task data.
+    The <instance> can also be used as the handle for <qCR_ExternControl>.
+    It must always be used together with a matching <qCR_End> statement.
+
+    > Note 1 : The <instance> must be initialized with QCR_INSTANCE_INITIALIZER
+               or zeroed (e.g. static storage) before the first run.
+    > Note 2 : Local variables are not preserved across the yield points, so
+               any per-object state must also live in the object.
+
+    */   
+    #define qCR_BeginWithInstance( instance )               _qCR_iStart( instance )
     /*qCR_Begin{
     
     }qCR_End;
@@ -250,9 +280,84 @@
     */        
     #define qCR_Delay( _qTime_t_ )                          _qCR_Delay( _qTime_t_ )
 
+    #if ( Q_COROUTINE_WAITS == 1 )
+        #define qCR_WaitForever                             ( qTimeImmediate )
+        
+        #if ( Q_QUEUES == 1 )
+        /*qCR_WaitQueue( qQueue_t *queue, void *dest, qTime_t timeout )
+
+        Blocks the coroutine until an item is available in the <queue> or the 
+        <timeout> expires. The item is received (removed from the front of the 
+        queue) and copied to <dest>. Unlike <qCR_WaitUntil>, the task is not 
+        dispatched while the coroutine is blocked: the kernel only releases it 
+        when the queue gets an item or the timeout expires.
+
+        Parameters:
+
+            - queue : A pointer to the qQueue_t object.
+            - dest : Pointer to the buffer into which the received item will be copied.
+            - timeout : The maximum amount of time (In seconds) to wait. 
+                        Use <qCR_WaitForever> to wait without a timeout.
+
+            > Note : After the wait, <qCR_TimeoutExpired> returns qTrue only 
+                     if the wait ended by timeout.
+
+        */
+        #define qCR_WaitQueue( _queue_, _dest_, _timeout_ )     _qCR_wu_Block( qQueue_Receive( (_queue_), (_dest_) ), (_queue_), 0uL, qFalse, (_timeout_) )
+        #endif
+
+        /*qCR_WaitNotification( qEvent_t e, qTime_t timeout )
+
+        Blocks the coroutine until the task receives a simple notification or the 
+        <timeout> expires. The task is not dispatched while the coroutine is 
+        blocked. When the wait ends by a notification, the task event info <e> 
+        holds the byNotificationSimple trigger and the notification data in the
+        <EventData> field.
+
+        Parameters:
+
+            - e : The task event info (the task callback argument).
+            - timeout : The maximum amount of time (In seconds) to wait. 
+                        Use <qCR_WaitForever> to wait without a timeout.
+
+            > Note : After the wait, <qCR_TimeoutExpired> returns qTrue only 
+                     if the wait ended by timeout.
+
+        */
+        #define qCR_WaitNotification( _e_, _timeout_ )          _qCR_wu_BlockFirst( ( byNotificationSimple == (_e_)->Trigger ), (_timeout_) )
+
+        #if ( Q_TASK_EVENT_FLAGS == 1 )
+        /*qCR_WaitEventFlags( qTask_Flag_t flags, qBool_t ClearOnExit, qBool_t CheckForAll, qTime_t timeout )
+
+        Blocks the coroutine until the event-flags of the running task are met 
+        or the <timeout> expires. The task is not dispatched while the coroutine 
+        is blocked.
+
+        Parameters:
+
+            - flags : A bitwise value that indicates the flags to wait for.
+            - ClearOnExit : If is set to qTrue then the awaited flags will be 
+                            cleared when the wait ends by the flags.
+            - CheckForAll : If is set to qTrue, all the <flags> must be set, 
+                            otherwise any of them is enough.
+            - timeout : The maximum amount of time (In seconds) to wait. 
+                        Use <qCR_WaitForever> to wait without a timeout.
+
+            > Note : After the wait, <qCR_TimeoutExpired> returns qTrue only 
+                     if the wait ended by timeout.
+
+        */
+        #define qCR_WaitEventFlags( _flags_, _clear_, _all_, _timeout_ )    _qCR_wu_Block( qTask_EventFlags_Check( qTask_Self(), (_flags_), (_clear_), (_all_) ), NULL, (_flags_), (_all_), (_timeout_) )
+        #endif
+    #endif
+
 
     void qCR_ExternControl( qCR_Handle_t h, const qCR_ExternAction_t action,  const qCR_ExtPosition_t pos );
     qBool_t _qCR_Sem( qCR_Semaphore_t * const sem,  const _qCR_Oper_t oper );
+    #if ( Q_COROUTINE_WAITS == 1 )
+        void _qCR_WaitBlock( void * const Queue, const qUINT32_t Flags, const qBool_t CheckForAll, const qSTimer_t * const Timeout );
+        qBool_t _qCR_WaitRelease( const qBool_t Released, qSTimer_t * const Timeout );
+    #endif
 
     #ifdef __cplusplus
     }
@@ -0,0 +1,27 @@
+/*This file is part of the QuarkTS distribution.*/
+#ifndef QCRC_H
+    #define QCRC_H
+
+    #include "qtypes.h"
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    #define QCRC8_INIT                  ( (qUINT8_t)0x00u )
+    #define QCRC16_INIT                 ( (qUINT16_t)0xFFFFu )
+    #define QCRC32_INIT                 ( 0xFFFFFFFFuL )
+    #define qCRC32_Final( _crc_ )       ( (qUINT32_t)( _crc_ ) ^ 0xFFFFFFFFuL )
+
+    qUINT8_t qCRC8_Update( qUINT8_t crc, const void *Data, size_t n );
+    qUINT16_t qCRC16_Update( qUINT16_t crc, const void *Data, size_t n );
+    qUINT32_t qCRC32_Update( qUINT32_t crc, const void *Data, size_t n );
+    qUINT8_t qCRC8( const void *Data, size_t n );
+    qUINT16_t qCRC16( const void *Data, size_t n );
+    qUINT32_t qCRC32( const void *Data, size_t n );
+
+    #ifdef __cplusplus
+    }
+    #endif
+
+#endif
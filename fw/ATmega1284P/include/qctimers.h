@@ -0,0 +1,47 @@
+/*This file is part of the QuarkTS distribution.*/
+#ifndef QCTIMERS_H
+    #define QCTIMERS_H
+
+    #include "qtypes.h"
+    #include "qclock.h"
+    #include "qlists.h"
+    #include "qkernel.h"
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    typedef struct _qCTimer_s qCTimer_t;
+    typedef void (*qCTimerFcn_t)( qCTimer_t * const Timer );
+
+    typedef enum{
+        qCTimer_OneShot,        /*< The timer expires once and stops. */
+        qCTimer_AutoReload      /*< The timer re-arms itself from its last expiration. */
+    }qCTimer_Mode_t;
+
+    /* Please don't access any members of this structure directly */
+    struct _qCTimer_s{
+        struct _qCTimer_Private_s{
+            qNode_MinimalFields;            /*< The timer node inside the service list. */
+            qCTimerFcn_t Callback;          /*< The function invoked when the timer expires. */
+            void *Data;                     /*< The timer storage pointer. */
+            qClock_t Expiry;                /*< The absolute expiration time in epochs. */
+            qClock_t Period;                /*< The reload period in epochs (0 for one-shot timers). */
+        }qPrivate;
+    };
+
+    #define QCTIMER_REMAINING_IN_STOPPED_STATE  ( 0xFFFFFFFFuL )
+
+    qBool_t qCTimer_Service_Setup( qTask_t * const Task, const qPriority_t Priority );
+    qBool_t qCTimer_Setup( qCTimer_t * const Timer, const qCTimerFcn_t Callback, void *Data );
+    qBool_t qCTimer_Start( qCTimer_t * const Timer, const qTime_t Time, const qCTimer_Mode_t Mode );
+    qBool_t qCTimer_Stop( qCTimer_t * const Timer );
+    qBool_t qCTimer_IsActive( const qCTimer_t * const Timer );
+    qClock_t qCTimer_Remaining( const qCTimer_t * const Timer );
+    void* qCTimer_Get_Data( const qCTimer_t * const Timer );
+
+    #ifdef __cplusplus
+    }
+    #endif
+
+#endif
@@ -4,6 +4,10 @@
 
     #include "qtypes.h"
     #include "qclock.h"
+    #include "qtasks.h"
+    #if ( Q_QUEUES == 1 )
+        #include "qqueues.h"
+    #endif
 
     #ifdef __cplusplus
     extern "C" {
@@ -17,6 +21,8 @@
     #define QEDGECHECK_UPDATE       ( (qUINT8_t)1u )
     #define QEDGECHECK_CHECK        ( (qUINT8_t)2u )
 
+    #define QEDGECHECK_PORT_SAMPLES ( 4u )  /*< Consecutive stable samples required to accept a level change on a port pin. */
+
     /* Please don't access any members of this structure directly */
     typedef struct _qEdgeCheck_IONode_s{
         struct _qEdgeCheck_IONode_Private_s{
@@ -28,14 +34,43 @@
         }qPrivate;       
     }qEdgeCheck_IONode_t;
 
+    /* Please don't access any members of this structure directly */
+    typedef struct _qEdgeCheck_PortNode_s{
+        struct _qEdgeCheck_PortNode_Private_s{
+            struct _qEdgeCheck_PortNode_s *Next;    /*< Point to the next node of the port list. */
+            const void *Port;                       /*< Point to the address of the hardware PORT/IO register. */
+            qUINT32_t Mask;                         /*< The pins of the port to check. */
+            qUINT32_t Levels;                       /*< The debounced levels of the masked pins. */
+            qUINT32_t Unknown;                      /*< The pins waiting for the debounce to finish. */
+            qUINT32_t Count0, Count1;               /*< The per-pin debounce counters (vertical counter bit-planes). */
+            qUINT32_t Rising;                       /*< The pins with a rising edge on the last update. */
+            qUINT32_t Falling;                      /*< The pins with a falling edge on the last update. */
+        }qPrivate;
+    }qEdgeCheck_PortNode_t;
+
+    typedef struct{
+        const qEdgeCheck_PortNode_t *Node;  /*< The port-node where the edges were detected. */
+        qUINT32_t Rising;                   /*< The pins with a rising edge. */
+        qUINT32_t Falling;                  /*< The pins with a falling edge. */
+        qClock_t Timestamp;                 /*< The epoch when the edges were accepted. */
+    }qEdgeCheck_Event_t;
+
     typedef qBool_t (*qCoreRegSize_t)(const void* arg1, qBool_t arg2);
+    typedef qUINT32_t (*qCorePortReader_t)(const void* arg1);
     
     /* Please don't access any members of this structure directly */
     typedef struct{
         struct _qEdgeCheck_Private_s{
             qEdgeCheck_IONode_t *Head;          /*< The first ionode in the list. */
+            qEdgeCheck_PortNode_t *PortHead;    /*< The first port node in the list. */
             qClock_t Start, DebounceTime;       /*< Debounce time control*/
+            qClock_t PortStart;                 /*< The last sampling time of the port-nodes*/
+            qTask_t *Task;                      /*< The task notified when port edges are detected*/
+            #if ( Q_QUEUES == 1 )
+                qQueue_t *Queue;                /*< The queue that receives the port edge records*/
+            #endif
             qCoreRegSize_t Reader;              /*< The xBits reg-reader function*/
+            qCorePortReader_t PortReader;       /*< The xBits whole-register reader function*/
             qUINT8_t State;                     /*< The node state*/
         }qPrivate;
     }qEdgeCheck_t;
@@ -43,12 +78,24 @@
     qBool_t _qReg_08Bits( const void *Address, qBool_t PinNumber );
     qBool_t _qReg_16Bits( const void *Address, qBool_t PinNumber );
     qBool_t _qReg_32Bits( const void *Address, qBool_t PinNumber );
+    qUINT32_t _qPort_08Bits( const void *Address );
+    qUINT32_t _qPort_16Bits( const void *Address );
+    qUINT32_t _qPort_32Bits( const void *Address );
     
     qBool_t qEdgeCheck_Setup( qEdgeCheck_t * const Instance, const qCoreRegSize_t RegisterSize, const qClock_t DebounceTime );
     qBool_t qEdgeCheck_Add_Node( qEdgeCheck_t * const Instance, qEdgeCheck_IONode_t * const Node, void *PortAddress, const qBool_t PinNumber );    
+    qBool_t qEdgeCheck_Add_PortNode( qEdgeCheck_t * const Instance, qEdgeCheck_PortNode_t * const Node, const void *PortAddress, const qUINT32_t PinMask );
     qBool_t qEdgeCheck_Update( qEdgeCheck_t * const Instance );
+    qBool_t qEdgeCheck_Set_EventTask( qEdgeCheck_t * const Instance, qTask_t * const Task );
+    #if ( Q_QUEUES == 1 )
+        qBool_t qEdgeCheck_Set_EventQueue( qEdgeCheck_t * const Instance, qQueue_t * const Queue );
+    #endif
     qBool_t qEdgeCheck_Get_NodeStatus( const qEdgeCheck_IONode_t * const Node );
     void qEdgeCheck_Set_NodePin( qEdgeCheck_IONode_t * const Node, const qBool_t PinNumber );
+    qUINT32_t qEdgeCheck_Get_PortLevels( const qEdgeCheck_PortNode_t * const Node );
+    qUINT32_t qEdgeCheck_Get_PortRising( const qEdgeCheck_PortNode_t * const Node );
+    qUINT32_t qEdgeCheck_Get_PortFalling( const qEdgeCheck_PortNode_t * const Node );
+    qBool_t qEdgeCheck_Get_PortPinStatus( const qEdgeCheck_PortNode_t * const Node, const qBool_t PinNumber );
 
     #ifdef __cplusplus
     }
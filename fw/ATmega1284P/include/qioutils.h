@@ -4,10 +4,10 @@
 
     #include "qtypes.h"
     #include "qconfig.h"
-    #include "qedgecheck.h"
     
     #include <string.h>
     #include <ctype.h>
+    #include <stdarg.h>
 
     #ifdef __cplusplus
     extern "C" {
@@ -20,7 +20,9 @@
     typedef char (*qGetChar_t)(void* arg1);
 
     char* qIOUtil_StrChr( const char *s, int c, size_t maxlen );
+    char* qIOUtil_BufStrChr( const char *buf, int c, size_t size );
     size_t qIOUtil_StrLen( const char* str, size_t maxlen); /* safe strlen */
+    size_t qIOUtil_BufStrLen( const char* buf, size_t size );
     size_t qIOUtil_StrlCpy( char * dst, const char * src, size_t maxlen ); /* safe strcpy */
     void qIOUtil_SwapBytes( void *Data, const size_t n );
     qBool_t qIOUtil_CheckEndianness( void );
@@ -28,6 +30,7 @@
     void qIOUtil_PrintXData( qPutChar_t fcn, void* pStorage, void *Data, size_t n );
     void qIOUtil_OutputRaw( qPutChar_t fcn, void* pStorage, void *Data, const size_t n, qBool_t AIP );
     void qIOUtil_InputRaw( const qGetChar_t fcn, void* pStorage, void *Data, const size_t n, qBool_t AIP );
+    size_t qIOUtil_Printf( qPutString_t fcn, void* pStorage, char *buffer, size_t size, const char *fmt, ... );
       
     /*qIOUtil_PrintString(fcn, pStorage, s)
     
@@ -23,6 +23,15 @@
     #define qIndefinite             ( qPeriodic )
     #define qSingleShot             ( (qIteration_t)(1) )
 
+    #if ( Q_CPU_LOAD_MONITOR == 1 )
+        typedef struct{
+            qUINT8_t Load;      /*< The CPU load in percent (Tasks + Kernel). */
+            qUINT8_t Idle;      /*< Percent of time spent in the idle-task or polling for events. */
+            qUINT8_t Tasks;     /*< Percent of time spent inside the task callbacks. */
+            qUINT8_t Kernel;    /*< Percent of time spent in the scheduler overhead. */
+        }qOS_CPUUsage_t;
+    #endif
+
     /*a single container is used to publish the private methods outside the kernel*/
     /* Please don't access any members of this structure directly */
 
@@ -39,7 +48,16 @@
         void qOS_Set_SchedulerReleaseCallback( qTaskFcn_t Callback );
     #endif       
 
+    #if ( QTASK_DEADLINES == 1 )
+        void qOS_Set_DeadlineMissCallback( qTaskDeadlineMissFcn_t Callback );
+    #endif
+
     qBool_t qOS_Notification_Spread( void *eventdata, const qTask_NotifyMode_t mode );
+    #if ( Q_NOTIFICATION_TOPICS > 0 )
+        qBool_t qOS_Notification_Subscribe( qTask_t * const Task, const qTopic_t Topics );
+        qBool_t qOS_Notification_Unsubscribe( qTask_t * const Task, const qTopic_t Topics );
+        qBool_t qOS_Notification_SpreadTopics( const qTopic_t Topics, void *eventdata, const qTask_NotifyMode_t mode );
+    #endif
     qBool_t qOS_Add_Task( qTask_t * const Task, qTaskFcn_t CallbackFcn, qPriority_t Priority, qTime_t Time, qIteration_t nExecutions, qState_t InitialState, void* arg );
     qBool_t qOS_Add_EventTask( qTask_t * const Task, qTaskFcn_t CallbackFcn, qPriority_t Priority, void* arg );
     #if ( Q_FSM == 1)
@@ -53,6 +71,14 @@
         qBool_t qOS_Add_ATCLITask( qTask_t * const Task, qATCLI_t *cli, qPriority_t Priority );
     #endif
 
+    #if ( Q_CPU_LOAD_MONITOR == 1 )
+        qUINT8_t qOS_Get_CPULoad( void );
+        qBool_t qOS_Get_CPUUsage( qOS_CPUUsage_t * const Usage );
+        #if ( Q_ATCLI == 1)
+            qBool_t qOS_ATCLI_CPULoadCmdSubscribe( qATCLI_t * const cli, qATCLI_Command_t * const Command );
+        #endif
+    #endif
+
     qBool_t qOS_Remove_Task( qTask_t * const Task );
     void qOS_Run( void );
     
@@ -10,17 +10,17 @@
     #endif
    
     /* Task flags
-    MSB---------------------------------------------------------------------------------------------------------------------------------------------------------LSB
-    | (31..11)EVENTFLAGS |  (10..8)-STATE  | 7-REM.REQ  | 6-SHUTDOWN | 5-QUEUE_EMPTY | 4-QUEUE_COUNT | 3-QUEUE_FULL | 2-QUEUE_RECEIVER |  1-ENABLED  |  0-INIT   |
-    |-----------------------------------------------------------------------------------------------------------------------------------------------------------|
+    MSB-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------LSB
+    | (31..12)EVENTFLAGS | 11-CR_WAIT_ALL | 10-CR_WAIT | 9-SKIP_LATE | 8-FIXED_RATE | 7-REM.REQ  | 6-SHUTDOWN | 5-QUEUE_EMPTY | 4-QUEUE_COUNT | 3-QUEUE_FULL | 2-QUEUE_RECEIVER |  1-ENABLED  |  0-INIT   |
+    |-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------|
     */
     #define QTASK_COREBITS_RMASK        ( 0x000000FFuL )	 
     #define QTASK_COREBITS_WMASK        ( 0xFFFFFF00uL )
     #define QTASK_COREBITS_OFFSET       ( 0 )
 
-    #define QTASK_STATEBITS_RMASK	    ( 0x00000F00uL )
-    #define QTASK_STATEBITS_WMASK	    ( 0xFFFFF0FFuL )
-    #define QTASK_STATEBITS_OFFSET      ( 8 )
+    #define QTASK_MODEBITS_RMASK        ( 0x00000F00uL )    /*< deadline policy and coroutine wait bits*/
+    #define QTASK_MODEBITS_WMASK        ( 0xFFFFF0FFuL )
+    #define QTASK_MODEBITS_OFFSET       ( 8 )
 
     #define QTASK_EVENTFLAGS_RMASK	    ( 0xFFFFF000uL )
     #define QTASK_EVENTFLAGS_WMASK	    ( 0x00000FFFuL )
@@ -36,6 +36,11 @@
     #define QTASK_BIT_QUEUE_EMPTY       ( 0x00000020uL )
     #define QTASK_BIT_SHUTDOWN          ( 0x00000040uL )
     #define QTASK_BIT_REMOVE_REQUEST    ( 0x00000080uL )    
+
+    #define QTASK_BIT_FIXED_RATE        ( 0x00000100uL )
+    #define QTASK_BIT_SKIP_LATE         ( 0x00000200uL )
+    #define QTASK_BIT_CR_WAIT           ( 0x00000400uL )
+    #define QTASK_BIT_CR_WAIT_ALL       ( 0x00000800uL )
    
     /*Private kernel shared functions*/
     #if ( Q_PRIO_QUEUE_SIZE > 0 ) 
@@ -4,6 +4,8 @@
 
     #include "qtypes.h"
     #include "qstimers.h"
+    #include "qcritical.h"
+    #include "qtasks.h"
 
     #include <string.h>
 
@@ -23,12 +25,58 @@
         }qPrivate;
     }qResponse_t;
 
+    typedef struct _qResponse_Capture_s qResponse_Capture_t;
+    typedef void (*qResponse_CaptureFcn_t)( qResponse_Capture_t * const Capture, const char *Payload, const size_t Length );
+
+    /* Please don't access any members of this structure directly */
+    struct _qResponse_Capture_s{
+        struct _qResponse_Capture_Private_s{
+            qResponse_Capture_t *Next;          /*< Point to the next capture of the handler. */
+            char *Buffer;                       /*< The caller storage where the payload is written. */
+            size_t Size;                        /*< The size of the storage. */
+            volatile size_t Length;             /*< The length of the captured payload. */
+            qResponse_CaptureFcn_t Callback;    /*< Invoked from <qResponse_Multi_Received> when the capture completes. */
+            qTask_t *Task;                      /*< The task notified from the ISR when the capture completes. */
+            qBase_t Pattern;                    /*< The index of the pattern that starts the capture. */
+            char Terminator;                    /*< The char that ends the payload. */
+            volatile qBool_t Ready;             /*< The payload is complete and has not been released. */
+        }qPrivate;
+    };
+
+    /* Please don't access any members of this structure directly */
+    typedef struct{
+        struct _qResponse_Multi_Private_s{
+            qResponse_Capture_t *Captures;      /*< The list of pattern captures. */
+            qResponse_Capture_t * volatile Capturing; /*< The capture in progress (NULL if none). */
+            const qUINT8_t *ClassMap;           /*< Maps every ASCII char to its input class(0 for chars not used by the patterns). */
+            const qUINT8_t *Accept;             /*< The pattern recognized on each state (index+1, 0 for none). */
+            const qUINT8_t *Delta;              /*< The automaton transitions : Delta[ State*Classes + Class ]. */
+            size_t Classes;                     /*< The number of input classes. */
+            volatile qUINT32_t Matched;         /*< One bit for every pattern recognized and not retrieved yet. */
+            volatile qUINT8_t State;            /*< The current state of the automaton. */
+        }qPrivate;
+    }qResponse_Multi_t;
+
+    #define QRESPONSE_MULTI_MAX_PATTERNS        ( 32u )
+    #define QRESPONSE_MULTI_NONE                ( -1 )
+    /*Workspace required by a set of patterns with <nChars> chars in total using <nClasses> distinct chars*/
+    #define QRESPONSE_MULTI_WORKSPACE( nChars, nClasses )   ( 128u + ( 2u*( (size_t)(nChars) + 1u ) ) + ( ( (size_t)(nChars) + 1u )*( (size_t)(nClasses) + 1u ) ) )
+
     void qResponse_Setup( qResponse_t * const obj, char *xLocBuff, size_t nMax ); 
     void qResponse_Reset( qResponse_t * const obj );
     qBool_t qResponse_Received( qResponse_t * const obj, const char *Pattern, size_t n );
     qBool_t qResponse_ReceivedWithTimeout( qResponse_t * const obj, const char *Pattern, size_t n, qTime_t t );
     qBool_t qResponse_ISRHandler( qResponse_t * const obj, const char rxchar );
 
+    qBool_t qResponse_Multi_Setup( qResponse_Multi_t * const obj, const char * const *Patterns, const size_t Count, qUINT8_t *Workspace, const size_t WorkspaceSize );
+    void qResponse_Multi_Reset( qResponse_Multi_t * const obj );
+    qBase_t qResponse_Multi_Received( qResponse_Multi_t * const obj );
+    qBool_t qResponse_Multi_ISRHandler( qResponse_Multi_t * const obj, const char rxchar );
+    qBool_t qResponse_Multi_Add_Capture( qResponse_Multi_t * const obj, qResponse_Capture_t * const Capture, const qBase_t Pattern, char *Buffer, const size_t Size, const char Terminator );
+    qBool_t qResponse_Capture_Set_Handler( qResponse_Capture_t * const Capture, const qResponse_CaptureFcn_t Callback, qTask_t * const Task );
+    const char* qResponse_Capture_Payload( const qResponse_Capture_t * const Capture, size_t * const Length );
+    void qResponse_Capture_Release( qResponse_Capture_t * const Capture );
+
     #ifdef __cplusplus
     }
     #endif
@@ -22,32 +22,45 @@
     extern "C" {
     #endif
 
+    #if ( ( Q_SCHEDULER_EDF == 1 ) || ( Q_TASK_DEADLINE_MONITOR == 1 ) )
+        #define QTASK_DEADLINES     ( 1 )   /*< The task deadlines are required by the EDF policy and the deadline monitor*/
+    #else
+        #define QTASK_DEADLINES     ( 0 )
+    #endif
+
     typedef enum {  qTriggerNULL, 
                     byTimeElapsed, 
                     byNotificationQueued, 
                     byNotificationSimple, 
+                    byNotificationMailbox, 
                     byQueueReceiver, 
                     byQueueFull, 
                     byQueueCount, 
                     byQueueEmpty, 
                     byEventFlags,
+                    byWaitRelease,
                     bySchedulingRelease, 
                     byNoReadyTasks
                 }qTrigger_t;
 
     #define qTrigger_NotificationSimple     ( byNotificationSimple )
     #define qTrigger_NotificationQueued     ( byNotificationQueued )
+    #define qTrigger_NotificationMailbox    ( byNotificationMailbox )
     #define qTrigger_TimeElapsed            ( byTimeElapsed )
     #define qTrigger_QueueReceiver          ( byQueueReceiver )
     #define qTrigger_QueueFull              ( byQueueFull )
     #define qTrigger_QueueCount             ( byQueueCount )
     #define qTrigger_QueueEmpty             ( byQueueEmpty )
     #define qTrigger_byEventFlags           ( byEventFlags )
+    #define qTrigger_WaitRelease            ( byWaitRelease )
     #define qTrigger_SchedulingRelease      ( bySchedulingRelease )
     #define qTrigger_NoReadyTasks           ( byNoReadyTasks )
 
     typedef qUINT32_t qNotifier_t;       
     typedef qUINT32_t qTask_Flag_t; 
+    typedef qUINT32_t qTopic_t;
+    /*The topic mask of the notification topic number n [0 - (Q_NOTIFICATION_TOPICS-1)]*/
+    #define QTOPIC( n )                     ( (qTopic_t)1uL << (n) )
     #define QMAX_NOTIFICATION_VALUE         ( 0xFFFFFFFFuL )
 
     typedef enum{
@@ -115,6 +128,12 @@
                         by qSendEvent. A pointer to the dequeued data will be 
                         available in the <EventData> field.
         
+        - byNotificationMailbox: When there are notifications posted in the task
+                        mailbox with qTask_Notification_Post. The front mail is
+                        extracted and a pointer to it (qTask_Mail_t) will be 
+                        available in the <EventData> field. The remaining mails
+                        can be extracted with qTask_Mailbox_Receive.
+
         - byQueueReceiver: When there are elements available in the attached qQueue,
                         the scheduler make a data dequeue (auto-receive) from the
                         front. A pointer to the received data will be 
@@ -129,6 +148,12 @@
         
         - byQueueEmpty: When the  attached qQueue is empty.  A pointer to the 
                         queue will be available in the <EventData> field.
+
+        - byEventFlags: When any of the task event-flags is set (or the awaited
+                        event-flags of a blocked coroutine are met).
+
+        - byWaitRelease: When the queue awaited by a blocked coroutine has items
+                        available or the coroutine wait timeout expires.
         
         - byNoReadyTasks: Only when the Idle Task is triggered.
         */
@@ -166,6 +191,24 @@
 
     typedef void (*qTaskFcn_t)( qEvent_t arg );  
 
+    #if ( Q_TASK_MAILBOX == 1 )
+        typedef struct{
+            void *Data;                             /*< The notification payload. */
+            qNotifier_t Value;                      /*< The notification value. */
+        }qTask_Mail_t;
+
+        /* Please don't access any members of this structure directly */
+        typedef struct{
+            struct _qTask_Mailbox_Private_s{
+                qTask_Mail_t *Slots;                /*< The ring of mails. */
+                size_t Size;                        /*< The number of slots. */
+                volatile size_t Head;               /*< The index of the front mail. */
+                volatile size_t Count;              /*< The number of pending mails. */
+                qTask_Mail_t Current;               /*< The mail delivered in the current dispatch. */
+            }qPrivate;
+        }qTask_Mailbox_t;
+    #endif
+
     /* Please don't access any members of this structure directly */
     typedef struct{ /*Task node definition*/
         struct _qTask_Private_s{    /*Task control block - TCB*/
@@ -186,14 +229,43 @@
             #if ( Q_PRESERVE_TASK_ENTRY_ORDER == 1 )
                 size_t Entry;                       /*< To allow the OS maintain the task entry order. */
             #endif
+            #if ( QTASK_DEADLINES == 1 )
+                qClock_t Deadline;                  /*< The relative deadline in epochs (0 = the task period). */
+                qClock_t AbsDeadline;               /*< The absolute deadline of the current release. */
+                qUINT32_t DeadlineMisses;           /*< The number of releases that finished past their deadline. */
+            #endif
+            #if ( Q_COROUTINE_WAITS == 1 )
+                #if ( Q_QUEUES == 1 )
+                    qQueue_t *WaitQueue;            /*< The queue awaited by the blocked coroutine. */
+                #endif
+                const qSTimer_t *WaitTimer;         /*< The timeout of the blocked coroutine. */
+                qTask_Flag_t WaitFlags;             /*< The event-flags awaited by the blocked coroutine. */
+            #endif
+            #if ( Q_NOTIFICATION_TOPICS > 0 )
+                void *TopicNext[ Q_NOTIFICATION_TOPICS ]; /*< The next subscriber of every topic. */
+                qTopic_t Topics;                    /*< The topics the task is subscribed to. */
+            #endif
             qIteration_t Iterations;                /*< Hold the number of iterations. */
             volatile qNotifier_t Notification;      /*< The notification value. */          
             volatile qTask_Flag_t Flags;            /*< Task flags (core and eventflags)*/
+            #if ( Q_TASK_MAILBOX == 1 )
+                qTask_Mailbox_t *Mailbox;           /*< The pointer to the attached notification mailbox. */
+            #endif
             qTrigger_t Trigger;                     /*< The event source that put the task in a qReady state. */
             qPriority_t Priority;                   /*< The task priority. */
         }qPrivate;
     }qTask_t;
 
+    #if ( QTASK_DEADLINES == 1 )
+        typedef Q_FUNC_ATTRIBUTE_PRE void (*qTaskDeadlineMissFcn_t)( qTask_t * const arg1, const qClock_t arg2 ) Q_FUNC_ATTRIBUTE_POS;
+
+        typedef enum{
+            qTask_FixedDelay = 0,   /*< The next release is scheduled one period after the release is detected (default). */
+            qTask_FixedRate,        /*< The next release is scheduled one period after the nominal release, late releases are caught up. */
+            qTask_FixedRateSkip     /*< Like qTask_FixedRate, but the releases already lost are skipped keeping the phase. */
+        }qTask_ReloadPolicy_t;
+    #endif
+
     #if ( Q_QUEUES == 1 )
         typedef enum {
             qQueueMode_Receiver  = 4,
@@ -208,6 +280,12 @@
     qBool_t qTask_Notification_Send( qTask_t * const Task, void* eventdata );
     qBool_t qTask_Notification_Queue( qTask_t * const Task, void* eventdata );
     qBool_t qTask_HasPendingNotifications( const qTask_t * const Task  );
+    #if ( Q_TASK_MAILBOX == 1 )
+        qBool_t qTask_Attach_Mailbox( qTask_t * const Task, qTask_Mailbox_t * const Mailbox, qTask_Mail_t * const Slots, const size_t Size );
+        qBool_t qTask_Notification_Post( qTask_t * const Task, void* eventdata, const qNotifier_t Value );
+        size_t qTask_Mailbox_Receive( qTask_t * const Task, qTask_Mail_t * const dest, const size_t Max );
+        size_t qTask_Mailbox_Count( const qTask_t * const Task );
+    #endif
     qState_t qTask_Get_State( const qTask_t * const Task);
     #if ( Q_TASK_COUNT_CYCLES == 1 )
         qCycles_t qTask_Get_Cycles( const qTask_t * const Task );   
@@ -216,6 +294,11 @@
     void qTask_Set_Time( qTask_t * const Task, const qTime_t Value );
     void qTask_Set_Iterations( qTask_t * const Task, const qIteration_t Value );
     void qTask_Set_Priority( qTask_t * const Task, const qPriority_t Value );
+    #if ( QTASK_DEADLINES == 1 )
+        void qTask_Set_Deadline( qTask_t * const Task, const qTime_t Value );
+        void qTask_Set_ReloadPolicy( qTask_t * const Task, const qTask_ReloadPolicy_t Policy );
+        qUINT32_t qTask_Get_DeadlineMisses( const qTask_t * const Task );
+    #endif
     void qTask_Set_Callback( qTask_t * const Task, const qTaskFcn_t CallbackFcn );
     void qTask_Set_State( qTask_t * const Task, const qState_t State );
     void qTask_Set_Data( qTask_t * const Task, void* arg );
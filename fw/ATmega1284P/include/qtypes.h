@@ -17,6 +17,7 @@
         typedef uint8_t qUINT8_t;
         typedef uint16_t qUINT16_t;
         typedef uint32_t qUINT32_t;
+        typedef uint64_t qUINT64_t;
         /*Signed types*/
         typedef int8_t qINT8_t;
         typedef int16_t qINT16_t;
@@ -26,6 +27,7 @@
         typedef unsigned char qUINT8_t; 
         typedef unsigned short qUINT16_t;
         typedef unsigned long qUINT32_t;    /*Not always true, be careful with this definition */
+        typedef unsigned long long qUINT64_t;
 
         /*Signed types*/
         typedef signed char qINT8_t;
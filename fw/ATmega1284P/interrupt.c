@@ -11,13 +11,18 @@
 #include "soft_pwm.h"
 
 extern volatile uint8_t TickCount;
-extern SFPWM_data_t SFPWM_data;
+extern SFPWM_bank_t SFPWM_bank;
 
 // TIMER0 overflow interrupt service routine
 // called whenever timer0 - CTC mode overflows
 ISR(TIMER0_COMPA_vect )    //TIMER0_OVF_vect)
 {   
    qClock_SysTick();  // esta es la que se necesita para que el OS funcione
-   SFPWM_Update(&SFPWM_data);;
     PORTB ^= (1 << 1);
 }
+
+// soft pwm : fires only on the pin transitions of the bank
+ISR(TIMER1_COMPA_vect)
+{
+   OCR1A += SFPWM_BankNextEdge(&SFPWM_bank);
+}
@@ -267,7 +267,7 @@ qBool_t qATCLI_ISRHandlerBlock( qATCLI_t * const cli, char *Data, const size_t n
             }
             else{
                 if( 0 != isgraph( (int)Data[ 0 ] ) ){
-                    if( NULL != qIOUtil_StrChr( Data, (int)'\r', MaxToInsert ) ){ /*find the end of line safely*/
+                    if( NULL != qIOUtil_BufStrChr( Data, (int)'\r', n ) ){ /*find the end of line safely, <Data> holds <n> bytes*/
                         (void)qIOUtil_StrlCpy( (char*)cli->qPrivate.Input.Buffer, Data, MaxToInsert ); /*safe string copy*/
                         RetValue = qATCLI_Notify( cli );
                     }
@@ -490,7 +490,7 @@ qBool_t qATCLI_Run( qATCLI_t * const cli ){
 			else if ( 0 == strncmp( (const char*)InputBuffer, QATCLI_DEFAULT_ID_COMMAND, Input->Size ) ){
                 OutputRetval = QATCLI_DEVID;		/*check if the input its an ID request using the ATID command*/
             }
-			else if	( qIOUtil_StrLen( (const char*)InputBuffer, Input->Size ) >= QATCLI_MIN_INPUT_LENGTH ){
+			else if	( qIOUtil_BufStrLen( (const char*)InputBuffer, Input->Size ) >= QATCLI_MIN_INPUT_LENGTH ){
                 OutputRetval = QATCLI_NOTFOUND;	/*check if it is pertinent to show the error*/
             }
 			else{
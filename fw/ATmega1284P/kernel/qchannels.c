@@ -0,0 +1,162 @@
+#include "qchannels.h"
+
+#if ( Q_CHANNELS == 1 )
+
+/*============================================================================*/
+/*qBool_t qChannel_Setup( qChannel_t * const ch, void *Storage, const size_t ItemSize, const size_t Capacity )
+
+Initialize a bounded channel to pass items between coroutines, tasks and
+interrupts. Items are transferred by copy, so the stages of a pipeline can
+stream data without intermediate global buffers. A regular task can consume
+a channel by attaching its queue (see <qChannel_Get_Queue>) in the
+qQueueMode_Receiver mode.
+
+Parameters:
+
+    - ch : A pointer to the channel object.
+    - Storage : The memory area used to hold the items. Must be at least
+                ( ItemSize*Capacity ) bytes.
+    - ItemSize : The size of every item in bytes.
+    - Capacity : The maximum number of items the channel can hold.
+
+Return value:
+
+    Returns qTrue on success, otherwise returns qFalse;
+*/
+qBool_t qChannel_Setup( qChannel_t * const ch, void *Storage, const size_t ItemSize, const size_t Capacity ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != ch ){
+        RetValue = qQueue_Setup( &ch->qPrivate.Queue, Storage, ItemSize, Capacity );
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qChannel_TrySend( qChannel_t * const ch, void *Item )
+
+Sends an item through the channel without waiting. Can be used from tasks
+and interrupts. Use <qCR_ChannelSend> inside a coroutine to wait for room.
+
+Parameters:
+
+    - ch : A pointer to the channel object.
+    - Item : A pointer to the item to send (copied to the channel).
+
+Return value:
+
+    qTrue if the item was sent, qFalse if the channel is full.
+*/
+qBool_t qChannel_TrySend( qChannel_t * const ch, void *Item ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != ch ){
+        RetValue = qQueue_SendToBack( &ch->qPrivate.Queue, Item );
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qChannel_TryReceive( qChannel_t * const ch, void *dest )
+
+Receives an item from the channel without waiting. Can be used from tasks
+and interrupts. Use <qCR_ChannelReceive> inside a coroutine to wait for an
+item.
+
+Parameters:
+
+    - ch : A pointer to the channel object.
+    - dest : Pointer to the buffer into which the received item will be copied.
+
+Return value:
+
+    qTrue if an item was received, qFalse if the channel is empty.
+*/
+qBool_t qChannel_TryReceive( qChannel_t * const ch, void *dest ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != ch ){
+        RetValue = qQueue_Receive( &ch->qPrivate.Queue, dest );
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBase_t qChannel_Select( qChannel_t * const * const Channels, const size_t Count, void *dest )
+
+Receives an item from the first channel of the list that has one available,
+without waiting. Use <qCR_ChannelSelect> inside a coroutine to wait for any
+of the channels.
+
+Parameters:
+
+    - Channels : An array of pointers to the channels. The array order defines
+                 the precedence when several channels are ready. NULL entries
+                 are skipped.
+    - Count : The number of channels in the array.
+    - dest : Pointer to the buffer into which the received item will be copied.
+             Must hold the largest item of the channels.
+
+Return value:
+
+    The index of the channel the item was received from, otherwise
+    QCHANNEL_SELECT_NONE if all the channels are empty.
+*/
+qBase_t qChannel_Select( qChannel_t * const * const Channels, const size_t Count, void *dest ){
+    qBase_t RetValue = QCHANNEL_SELECT_NONE;
+
+    if( NULL != Channels ){
+        size_t i;
+
+        for( i = 0u ; i < Count ; ++i ){
+            if( qChannel_TryReceive( Channels[ i ], dest ) ){
+                RetValue = (qBase_t)i;
+                break;
+            }
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*size_t qChannel_Count( const qChannel_t * const ch )
+
+Returns the number of items waiting in the channel.
+
+Parameters:
+
+    - ch : A pointer to the channel object.
+
+Return value:
+
+    The number of items in the channel.
+*/
+size_t qChannel_Count( const qChannel_t * const ch ){
+    size_t RetValue = 0u;
+
+    if( NULL != ch ){
+        RetValue = qQueue_Count( &ch->qPrivate.Queue );
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qQueue_t* qChannel_Get_Queue( qChannel_t * const ch )
+
+Get the queue that holds the channel items. Can be attached to a regular task
+with <qTask_Attach_Queue> so the task gets dispatched on every item.
+
+Parameters:
+
+    - ch : A pointer to the channel object.
+
+Return value:
+
+    A pointer to the channel queue. NULL if <ch> is NULL.
+*/
+qQueue_t* qChannel_Get_Queue( qChannel_t * const ch ){
+    qQueue_t *RetValue = NULL;
+
+    if( NULL != ch ){
+        RetValue = &ch->qPrivate.Queue;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+
+#endif /* #if ( Q_CHANNELS == 1 ) */
@@ -1,12 +1,26 @@
 #include "qclock.h"
+#if ( Q_CLOCK_EXTENDED == 1 )
+    #include "qcritical.h"
+#endif
 
 static qClock_t qClock_InternalTick( void );
 
 static volatile qClock_t qSysTick_Epochs = 0uL;
+static volatile qUINT8_t qSysTick_Sequence = 0u; /*< Changes on every tick, allows readers to detect a torn read of the epochs. */
+#if ( Q_CLOCK_EXTENDED == 1 )
+    static volatile qClock_t qSysTick_EpochsHigh = 0uL;     /*< The upper half of the 64-bit epoch maintained by <qClock_SysTick>. */
+    static qClock_t qExtended_LastTick = 0uL;               /*< The last tick seen from an external provider. */
+    static qClock_t qExtended_High = 0uL;                   /*< The upper half of the 64-bit epoch for external providers. */
+    static qClock_SubTickFcn_t SubTickProvider = NULL;
+    static qUINT32_t SubTickResolution = 1uL;
+#endif
 #define QFLT_TIME_FIX_VALUE  ( 0.5f )
 
 #if (Q_SETUP_TIME_CANONICAL != 1)
 static qTimingBase_t TimmingBase;
+#if ( Q_SETUP_TICK_IN_HERTZ != 1 )
+static qTime_t TimmingRate = qTimeImmediate; /*< The reciprocal of the time-base, precomputed to avoid a division on every conversion*/
+#endif
 /*============================================================================*/
 /*void qClock_SetTimeBase( const qTimingBase_t tb )
 
@@ -14,16 +28,30 @@ Set the system time-base for time conversions
 
 Parameters:
 
-    - tb : Time base 
+    - tb : Time base. If Q_SETUP_TIME_FIXEDPOINT is enabled, this should be the
+           tick frequency in Hertz (1 to 65535).
 
 */
 void qClock_SetTimeBase( const qTimingBase_t tb ){
     TimmingBase = tb;
+    #if ( Q_SETUP_TICK_IN_HERTZ != 1 )
+        if( tb > qTimeImmediate ){
+            TimmingRate = 1.0f/tb;
+        }
+    #endif
 } 
 #endif
 /*============================================================================*/
 static qClock_t qClock_InternalTick( void ){
-    return qSysTick_Epochs;
+    qClock_t RetValue;
+    qUINT8_t Sequence;
+
+    do{ /*retry if the tick ISR preempts the read : 32-bit loads are not atomic on 8/16-bit cores*/
+        Sequence = qSysTick_Sequence;
+        RetValue = qSysTick_Epochs;
+    }while( Sequence != qSysTick_Sequence );
+
+    return RetValue;
 } 
 /*============================================================================*/
 /*void qClock_SetTickProvider( qGetTickFcn_t provider )
@@ -56,11 +84,21 @@ Parameters:
 
 Return value:
 
-    time (t) in seconds
+    time (t) in seconds (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is enabled)
 */
 qTime_t qClock_Convert2Time( const qClock_t t ){
     #if ( Q_SETUP_TIME_CANONICAL == 1 )
         return (qTime_t)t;
+    #elif ( Q_SETUP_TIME_FIXEDPOINT == 1 )
+        qTime_t RetValue = qTimeImmediate;
+
+        if( TimmingBase > 0uL ){
+            qClock_t Seconds = t/TimmingBase;
+            qClock_t Remainder = t - ( Seconds*TimmingBase );
+            /*the remainder is below the tick frequency, so its Q16.16 scaling fits in 32 bits*/
+            RetValue = (qTime_t)( Seconds << QTIME_FRACTION_BITS ) + (qTime_t)( ( ( Remainder << QTIME_FRACTION_BITS ) + ( TimmingBase >> 1 ) )/TimmingBase );
+        }
+        return RetValue;
     #else
         #if ( Q_SETUP_TICK_IN_HERTZ == 1 )
             return (qTime_t)( t/TimmingBase );
@@ -78,7 +116,8 @@ Convert the specified input time(seconds) to time(epochs)
 
 Parameters:
 
-    - t : time in seconds   
+    - t : time in seconds (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is enabled,
+          see <qTime_Seconds>)
 
 Return value:
 
@@ -87,13 +126,18 @@ Return value:
 qClock_t qClock_Convert2Clock( const qTime_t t ){
     #if ( Q_SETUP_TIME_CANONICAL == 1 )
         return (qClock_t)t;
+    #elif ( Q_SETUP_TIME_FIXEDPOINT == 1 )
+        qClock_t Seconds = (qClock_t)( t >> QTIME_FRACTION_BITS );
+        qClock_t Fraction = (qClock_t)( t & 0x0000FFFFuL );
+        /*integer-only : the frequency is split in halves to keep every product inside 32 bits (rounded to the nearest epoch)*/
+        return ( Seconds*TimmingBase ) + ( Fraction*( TimmingBase >> QTIME_FRACTION_BITS ) ) + ( ( ( Fraction*( TimmingBase & 0x0000FFFFuL ) ) + 0x00008000uL ) >> QTIME_FRACTION_BITS );
     #else 
         #if ( Q_SETUP_TICK_IN_HERTZ == 1 )
             return (qClock_t)( t*TimmingBase );
         #else
             qTime_t epochs = qTimeImmediate;
             if( t > qTimeImmediate ){
-                epochs = ( t/TimmingBase ) + QFLT_TIME_FIX_VALUE;
+                epochs = ( t*TimmingRate ) + QFLT_TIME_FIX_VALUE; /*multiply by the precomputed reciprocal instead of dividing*/
             }           
             return (qClock_t)epochs;
         #endif    
@@ -107,7 +151,13 @@ Feed the system tick. This call is mandatory and must be called once inside the
 dedicated timer interrupt service routine (ISR). 
 */    
 void qClock_SysTick( void ){ 
+    ++qSysTick_Sequence;
     ++qSysTick_Epochs; 
+    #if ( Q_CLOCK_EXTENDED == 1 )
+        if( 0uL == qSysTick_Epochs ){
+            ++qSysTick_EpochsHigh; /*carry to the upper half of the 64-bit epoch*/
+        }
+    #endif
 }
 /*============================================================================*/
 /*qClock_t qClock_GetTick( void )
@@ -149,3 +199,112 @@ qBool_t qClock_TimeDeadlineCheck( const qClock_t ti, const qClock_t td ){
     return RetValue; 
 }
 /*============================================================================*/
+#if ( Q_CLOCK_EXTENDED == 1 )
+/*qUINT64_t qClock_GetEpoch64( void )
+
+Return the 64-bit monotonic epoch count. This value never wraps in practice, 
+so it can be used for long-term timestamps and durations.
+When the tick is fed by <qClock_SysTick>, the upper half is maintained by the 
+tick ISR and the read is retried if the ISR preempts it (safe on 8-bit cores).
+With an external tick provider, the wraps are detected in software, so this 
+function must be called at least once per wrap period of the provider.
+
+Return value:
+
+    The 64-bit epoch count
+*/
+qUINT64_t qClock_GetEpoch64( void ){
+    qUINT64_t RetValue;
+
+    if( &qClock_InternalTick == qClock_GetTick ){
+        qClock_t High, Low;
+        qUINT8_t Sequence;
+
+        do{
+            Sequence = qSysTick_Sequence;
+            High = qSysTick_EpochsHigh;
+            Low = qSysTick_Epochs;
+        }while( Sequence != qSysTick_Sequence );
+        RetValue = ( (qUINT64_t)High << 32 ) | (qUINT64_t)Low;
+    }
+    else{
+        qClock_t Now;
+
+        qCritical_Enter();
+        Now = qClock_GetTick();
+        if( Now < qExtended_LastTick ){
+            ++qExtended_High; /*the provider wrapped since the last call*/
+        }
+        qExtended_LastTick = Now;
+        RetValue = ( (qUINT64_t)qExtended_High << 32 ) | (qUINT64_t)Now;
+        qCritical_Exit();
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*void qClock_SetSubTickProvider( const qClock_SubTickFcn_t Provider, const qUINT32_t Resolution )
+
+Set the function that provides the sub-tick count, usually the counter register 
+of the hardware timer that generates the tick. Used by <qClock_GetTimestamp>.
+
+Parameters:
+
+    - Provider : A pointer to the sub-tick provider function  
+                 qUINT32_t fcn(void)
+                 Should return a value between 0 and <Resolution>-1 that 
+                 counts up within the current epoch. Pass NULL to disable it.
+    - Resolution : The number of sub-ticks per epoch. ( e.g. on a timer in CTC 
+                   mode: the compare value plus one )
+
+*/
+void qClock_SetSubTickProvider( const qClock_SubTickFcn_t Provider, const qUINT32_t Resolution ){
+    qCritical_Enter();
+    if( ( NULL != Provider ) && ( Resolution > 0uL ) ){
+        SubTickProvider = Provider;
+        SubTickResolution = Resolution;
+    }
+    else{
+        SubTickProvider = NULL;
+        SubTickResolution = 1uL;
+    }
+    qCritical_Exit();
+}
+/*============================================================================*/
+/*qUINT64_t qClock_GetTimestamp( void )
+
+Return a high-resolution monotonic timestamp that combines the 64-bit epoch with
+the sub-tick count. Intended for profiling and tracing purposes.
+
+    > Note : Call it with interrupts enabled. If the hardware counter rolls over
+             while the tick ISR is kept pending, the sub-tick count can not be 
+             attributed to the right epoch.
+
+Return value:
+
+    The timestamp in sub-tick units ( epochs*Resolution + sub-ticks ). If no 
+    sub-tick provider has been set, the timestamp is given in epochs.
+*/
+qUINT64_t qClock_GetTimestamp( void ){
+    qUINT64_t Epochs;
+    qUINT32_t SubTicks = 0uL;
+    qClock_SubTickFcn_t Provider = SubTickProvider;
+
+    if( NULL != Provider ){
+        qUINT8_t Sequence;
+
+        do{ /*epoch and sub-tick must belong to the same tick*/
+            Sequence = qSysTick_Sequence;
+            Epochs = qClock_GetEpoch64();
+            SubTicks = Provider();
+        }while( Sequence != qSysTick_Sequence );
+        if( SubTicks >= SubTickResolution ){
+            SubTicks = SubTickResolution - 1uL;
+        }
+    }
+    else{
+        Epochs = qClock_GetEpoch64();
+    }
+    return ( Epochs*(qUINT64_t)SubTickResolution ) + (qUINT64_t)SubTicks;
+}
+/*============================================================================*/
+#endif /* #if ( Q_CLOCK_EXTENDED == 1 ) */
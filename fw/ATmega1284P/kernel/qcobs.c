@@ -0,0 +1,261 @@
+#include "qcobs.h"
+
+#if ( Q_COBS_FRAMING == 1 )
+
+#define QCOBS_MAX_CODE      ( 0xFFu )
+
+/*============================================================================*/
+/*qBool_t qCOBS_Receiver_Setup( qCOBS_Receiver_t * const rx, volatile qUINT8_t *Storage, const size_t Size, qTask_t * const Consumer )
+
+Initialize a COBS(Consistent Overhead Byte Stuffing) frame receiver. The
+incoming bytes are kept encoded inside a byte-sized buffer built over <Storage>,
+so no intermediate frame buffer is required: the payload gets decoded straight
+from the storage to the destination when the frame is read with <qCOBS_Read>.
+
+Parameters:
+
+    - rx : A pointer to the COBS receiver object.
+    - Storage : Block of memory used to hold the encoded frames.
+    - Size : The size of the storage (Must be a power of two).
+    - Consumer : The task that gets a simple notification every time a
+                 complete frame arrives. The receiver pointer is passed
+                 through the <EventData> field. Can be NULL.
+
+Return value:
+
+    Returns qTrue on success, otherwise returns qFalse;
+*/
+qBool_t qCOBS_Receiver_Setup( qCOBS_Receiver_t * const rx, volatile qUINT8_t *Storage, const size_t Size, qTask_t * const Consumer ){
+    qBool_t RetValue = qFalse;
+
+    if( ( NULL != rx ) && ( NULL != Storage ) && ( Size > 0u ) ){
+        qBSBuffer_Setup( &rx->qPrivate.Buffer, Storage, Size );
+        rx->qPrivate.Consumer = Consumer;
+        rx->qPrivate.FrameStart = 0u;
+        rx->qPrivate.Frames = 0u;
+        rx->qPrivate.Dropped = 0u;
+        rx->qPrivate.Discard = qFalse;
+        RetValue = qTrue;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qCOBS_Receiver_ISRHandler( qCOBS_Receiver_t * const rx, const qUINT8_t Byte )
+
+Feed the COBS receiver with a single byte. This call is mandatory from an
+interrupt context. Put it inside the desired peripheral's ISR.
+The frame boundaries are detected here, so the consumer task is notified only
+once per frame instead of once per byte. Empty frames are ignored and if a frame
+does not fit in the storage, the partial frame is rolled back and the bytes are
+discarded until the next delimiter.
+
+Parameters:
+
+    - rx : A pointer to the COBS receiver object.
+    - Byte : The incoming byte.
+
+Return value:
+
+    qTrue when a complete frame has been received, otherwise returns qFalse.
+*/
+qBool_t qCOBS_Receiver_ISRHandler( qCOBS_Receiver_t * const rx, const qUINT8_t Byte ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != rx ){
+        qBSBuffer_t * const Buffer = &rx->qPrivate.Buffer;
+
+        if( QCOBS_DELIMITER == Byte ){
+            if( qTrue == rx->qPrivate.Discard ){
+                rx->qPrivate.Discard = qFalse; /*the overflowed frame ends here*/
+            }
+            else if( Buffer->qPrivate.head != rx->qPrivate.FrameStart ){
+                if( qTrue == qBSBuffer_Put( Buffer, Byte ) ){ /*the delimiter is kept to split the frames*/
+                    ++rx->qPrivate.Frames;
+                    (void)qTask_Notification_Send( rx->qPrivate.Consumer, rx );
+                    RetValue = qTrue;
+                }
+                else{
+                    Buffer->qPrivate.head = rx->qPrivate.FrameStart;
+                    ++rx->qPrivate.Dropped;
+                }
+            }
+            else{
+                /*nothing to do, empty frame*/
+            }
+            rx->qPrivate.FrameStart = Buffer->qPrivate.head;
+        }
+        else if( qFalse == rx->qPrivate.Discard ){
+            if( qFalse == qBSBuffer_Put( Buffer, Byte ) ){
+                Buffer->qPrivate.head = rx->qPrivate.FrameStart; /*roll back the partial frame*/
+                rx->qPrivate.Discard = qTrue;
+                ++rx->qPrivate.Dropped;
+            }
+        }
+        else{
+            /*nothing to do, waiting for the next delimiter*/
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*size_t qCOBS_Receiver_Frames( const qCOBS_Receiver_t * const rx )
+
+Query the number of complete frames waiting to be read.
+
+Parameters:
+
+    - rx : A pointer to the COBS receiver object.
+
+Return value:
+
+    The number of complete frames.
+*/
+size_t qCOBS_Receiver_Frames( const qCOBS_Receiver_t * const rx ){
+    size_t RetValue = 0u;
+
+    if( NULL != rx ){
+        qCritical_Enter();
+        RetValue = rx->qPrivate.Frames;
+        qCritical_Exit();
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*size_t qCOBS_Receiver_Dropped( const qCOBS_Receiver_t * const rx )
+
+Query the number of frames discarded because they did not fit in the storage.
+
+Parameters:
+
+    - rx : A pointer to the COBS receiver object.
+
+Return value:
+
+    The number of discarded frames.
+*/
+size_t qCOBS_Receiver_Dropped( const qCOBS_Receiver_t * const rx ){
+    size_t RetValue = 0u;
+
+    if( NULL != rx ){
+        qCritical_Enter();
+        RetValue = rx->qPrivate.Dropped;
+        qCritical_Exit();
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*size_t qCOBS_Read( qCOBS_Receiver_t * const rx, void *dest, const size_t MaxLength )
+
+Decode the oldest complete frame directly from the receiver storage to <dest>.
+The frame is always removed from the receiver, even if it was malformed or did
+not fit in the destination.
+
+Parameters:
+
+    - rx : A pointer to the COBS receiver object.
+    - dest : The location where the decoded payload will be written.
+    - MaxLength : The size of the destination.
+
+Return value:
+
+    The length of the decoded payload. Zero if there are no frames available,
+    the frame is malformed or the payload does not fit in <dest>.
+*/
+size_t qCOBS_Read( qCOBS_Receiver_t * const rx, void *dest, const size_t MaxLength ){
+    size_t RetValue = 0u;
+
+    if( ( NULL != dest ) && ( qCOBS_Receiver_Frames( rx ) > 0u ) ){
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        qUINT8_t *Data = (qUINT8_t*)dest; /*MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed*/
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        qUINT8_t Byte = QCOBS_DELIMITER, Code = QCOBS_MAX_CODE, Remaining = 0u;
+        size_t n = 0u;
+        qBool_t Valid = qTrue;
+
+        while( ( qTrue == qBSBuffer_Get( &rx->qPrivate.Buffer, &Byte ) ) && ( QCOBS_DELIMITER != Byte ) ){
+            qBool_t Emit = qTrue;
+
+            if( 0u == Remaining ){ /*this is a code byte*/
+                Emit = ( QCOBS_MAX_CODE != Code )? qTrue : qFalse; /*the previous block ended with a zero*/
+                Code = Byte;
+                Remaining = Code - 1u;
+                Byte = 0u;
+            }
+            else{
+                --Remaining;
+            }
+            if( qTrue == Emit ){
+                if( n < MaxLength ){
+                    Data[ n ] = Byte; /*MISRAC2004-17.4_b deviation allowed*/
+                }
+                else{
+                    Valid = qFalse; /*keep consuming to reach the delimiter*/
+                }
+                ++n;
+            }
+        }
+        qCritical_Enter();
+        --rx->qPrivate.Frames;
+        qCritical_Exit();
+        if( ( qTrue == Valid ) && ( 0u == Remaining ) ){
+            RetValue = n;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qCOBS_Write( qBSBuffer_t * const tx, const void *Data, const size_t n )
+
+Encode a payload as a COBS frame (including the trailing delimiter) directly
+into a byte-sized buffer, usually drained by a transmitter ISR. Every code byte
+is back-patched in place once its block is known, and the buffer head only moves
+after the whole frame is written, so the ISR never sees a partial frame.
+
+Parameters:
+
+    - tx : A pointer to the qBSBuffer(Byte-sized Buffer) object.
+    - Data : The payload to be encoded.
+    - n : The length of the payload.
+
+Return value:
+
+    Returns qTrue on success, or qFalse if the buffer does not have room
+    for the worst-case encoded frame <QCOBS_ENCODED_MAX>(n).
+*/
+qBool_t qCOBS_Write( qBSBuffer_t * const tx, const void *Data, const size_t n ){
+    qBool_t RetValue = qFalse;
+
+    if( ( NULL != tx ) && ( NULL != Data ) ){
+        if( QCOBS_ENCODED_MAX( n ) <= ( tx->qPrivate.length - qBSBuffer_Count( tx ) ) ){
+            /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+            const qUINT8_t *Src = (const qUINT8_t*)Data; /*MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed*/
+            /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+            volatile qUINT8_t * const Ring = tx->qPrivate.buffer;
+            const qIndex_t Mask = (qIndex_t)tx->qPrivate.length - 1u; /*the length is always a power of two*/
+            qIndex_t Head = tx->qPrivate.head;
+            qIndex_t CodeIndex = Head++;
+            qUINT8_t Code = 1u;
+            size_t i;
+
+            for( i = 0u ; i < n ; ++i ){
+                if( 0u != Src[ i ] ){
+                    Ring[ Head++ & Mask ] = Src[ i ]; /*MISRAC2004-17.4_b deviation allowed*/
+                    ++Code;
+                }
+                if( ( 0u == Src[ i ] ) || ( QCOBS_MAX_CODE == Code ) ){
+                    Ring[ CodeIndex & Mask ] = Code; /*back-patch the code of the finished block*/
+                    CodeIndex = Head++;
+                    Code = 1u;
+                }
+            }
+            Ring[ CodeIndex & Mask ] = Code;
+            Ring[ Head++ & Mask ] = QCOBS_DELIMITER;
+            tx->qPrivate.head = Head; /*publish the whole frame at once*/
+            RetValue = qTrue;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+
+#endif /* #if ( Q_COBS_FRAMING == 1 ) */
@@ -1,5 +1,9 @@
 #include "qcoroutine.h"
 
+#if ( Q_COROUTINE_WAITS == 1 )
+    #include "qkshared.h" /*kernel shared methods*/
+#endif
+
 /*============================================================================*/
 /*void qCR_ExternControl( qCR_Handle_t h, const qCR_ExternAction_t action,  const qCR_ExtPosition_t pos )
 
@@ -72,4 +76,55 @@ qBool_t _qCR_Sem( qCR_Semaphore_t * const sem,  const _qCR_Oper_t oper ){
     }
     return RetValue;
 }
-/*============================================================================*/
\ No newline at end of file
+/*============================================================================*/
+#if ( Q_COROUTINE_WAITS == 1 )
+/* Used to block the running task on a coroutine wait. The kernel only checks 
+the awaited object (<Queue>, <Flags> or the task notifications when both are 
+empty) and the <Timeout> until the task gets released. On queue waits, 
+<CheckForAll> selects a wait for room instead of a wait for an item.
+Do not use this function explicitly, use the provided coroutine statements 
+instead : <qCR_WaitQueue>, <qCR_WaitNotification> and <qCR_WaitEventFlags>
+*/
+void _qCR_WaitBlock( void * const Queue, const qUINT32_t Flags, const qBool_t CheckForAll, const qSTimer_t * const Timeout ){
+    qTask_t * const Task = qTask_Self();
+
+    if( NULL != Task ){ /*outside a task, the coroutine just yields and polls*/
+        #if ( Q_QUEUES == 1 )
+            /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+            Task->qPrivate.WaitQueue = (qQueue_t*)Queue; /* MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed */
+            /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        #else
+            Q_UNUSED( Queue );
+        #endif
+        Task->qPrivate.WaitFlags = Flags & QTASK_EVENTFLAGS_RMASK;
+        Task->qPrivate.WaitTimer = Timeout;
+        qOS_Set_TaskFlags( Task, QTASK_BIT_CR_WAIT_ALL, CheckForAll );
+        qOS_Set_TaskFlags( Task, QTASK_BIT_CR_WAIT, qTrue );
+    }
+}
+/*============================================================================*/
+/* Used to resolve a coroutine wait. When the wait gets <Released> by the awaited 
+object, the timeout is disarmed so <qCR_TimeoutExpired> only reports timeouts.
+Do not use this function explicitly, use the provided coroutine statements 
+instead : <qCR_WaitQueue>, <qCR_WaitNotification> and <qCR_WaitEventFlags>
+*/
+qBool_t _qCR_WaitRelease( const qBool_t Released, qSTimer_t * const Timeout ){
+    qBool_t RetValue = Released;
+
+    if( qTrue == Released ){
+        qSTimer_Disarm( Timeout );
+    }
+    else{
+        RetValue = qSTimer_Expired( Timeout );
+    }
+    if( qTrue == RetValue ){
+        qTask_t * const Task = qTask_Self();
+
+        if( NULL != Task ){ /*the task can be released by a higher precedence event, so drop the wait here*/
+            qOS_Set_TaskFlags( Task, QTASK_BIT_CR_WAIT | QTASK_BIT_CR_WAIT_ALL, qFalse );
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+#endif
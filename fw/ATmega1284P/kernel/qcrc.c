@@ -0,0 +1,657 @@
+#include "qcrc.h"
+
+#if ( Q_CRC == 1 )
+
+#define QCRC_MODE_BITWISE       ( 0 )
+#define QCRC_MODE_NIBBLE        ( 1 )
+#define QCRC_MODE_TABLE         ( 2 )
+#define QCRC_MODE_SLICE         ( 3 )
+
+/*slice-by-8 only pays off on 32/64-bit cores, smaller ones fall back to the byte-table*/
+#if ( Q_CRC_MODE == QCRC_MODE_SLICE )
+    #if defined( SIZE_MAX )
+        #if ( SIZE_MAX >= 0xFFFFFFFFu )
+            #define QCRC_SLICE_BY_8     ( 1 )
+        #endif
+    #endif
+#endif
+#ifndef QCRC_SLICE_BY_8
+    #define QCRC_SLICE_BY_8     ( 0 )
+#endif
+
+#define QCRC8_POLY              ( 0x07u )           /*< x^8 + x^2 + x + 1 */
+#define QCRC16_POLY             ( 0x1021u )         /*< x^16 + x^12 + x^5 + 1 */
+#define QCRC32_POLY_REFLECTED   ( 0xEDB88320uL )    /*< 0x04C11DB7 reflected */
+
+#if ( Q_CRC_MODE == QCRC_MODE_NIBBLE )
+    static const qUINT8_t qCRC8_Table[ 16 ] = {
+        0x00u, 0x07u, 0x0Eu, 0x09u, 0x1Cu, 0x1Bu, 0x12u, 0x15u,
+        0x38u, 0x3Fu, 0x36u, 0x31u, 0x24u, 0x23u, 0x2Au, 0x2Du
+    };
+    static const qUINT16_t qCRC16_Table[ 16 ] = {
+        0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+        0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu
+    };
+    static const qUINT32_t qCRC32_Table[ 16 ] = {
+        0x00000000uL, 0x1DB71064uL, 0x3B6E20C8uL, 0x26D930ACuL,
+        0x76DC4190uL, 0x6B6B51F4uL, 0x4DB26158uL, 0x5005713CuL,
+        0xEDB88320uL, 0xF00F9344uL, 0xD6D6A3E8uL, 0xCB61B38CuL,
+        0x9B64C2B0uL, 0x86D3D2D4uL, 0xA00AE278uL, 0xBDBDF21CuL
+    };
+#elif ( Q_CRC_MODE != QCRC_MODE_BITWISE )
+    static const qUINT8_t qCRC8_Table[ 256 ] = {
+        0x00u, 0x07u, 0x0Eu, 0x09u, 0x1Cu, 0x1Bu, 0x12u, 0x15u, 0x38u, 0x3Fu, 0x36u, 0x31u, 0x24u, 0x23u, 0x2Au, 0x2Du,
+        0x70u, 0x77u, 0x7Eu, 0x79u, 0x6Cu, 0x6Bu, 0x62u, 0x65u, 0x48u, 0x4Fu, 0x46u, 0x41u, 0x54u, 0x53u, 0x5Au, 0x5Du,
+        0xE0u, 0xE7u, 0xEEu, 0xE9u, 0xFCu, 0xFBu, 0xF2u, 0xF5u, 0xD8u, 0xDFu, 0xD6u, 0xD1u, 0xC4u, 0xC3u, 0xCAu, 0xCDu,
+        0x90u, 0x97u, 0x9Eu, 0x99u, 0x8Cu, 0x8Bu, 0x82u, 0x85u, 0xA8u, 0xAFu, 0xA6u, 0xA1u, 0xB4u, 0xB3u, 0xBAu, 0xBDu,
+        0xC7u, 0xC0u, 0xC9u, 0xCEu, 0xDBu, 0xDCu, 0xD5u, 0xD2u, 0xFFu, 0xF8u, 0xF1u, 0xF6u, 0xE3u, 0xE4u, 0xEDu, 0xEAu,
+        0xB7u, 0xB0u, 0xB9u, 0xBEu, 0xABu, 0xACu, 0xA5u, 0xA2u, 0x8Fu, 0x88u, 0x81u, 0x86u, 0x93u, 0x94u, 0x9Du, 0x9Au,
+        0x27u, 0x20u, 0x29u, 0x2Eu, 0x3Bu, 0x3Cu, 0x35u, 0x32u, 0x1Fu, 0x18u, 0x11u, 0x16u, 0x03u, 0x04u, 0x0Du, 0x0Au,
+        0x57u, 0x50u, 0x59u, 0x5Eu, 0x4Bu, 0x4Cu, 0x45u, 0x42u, 0x6Fu, 0x68u, 0x61u, 0x66u, 0x73u, 0x74u, 0x7Du, 0x7Au,
+        0x89u, 0x8Eu, 0x87u, 0x80u, 0x95u, 0x92u, 0x9Bu, 0x9Cu, 0xB1u, 0xB6u, 0xBFu, 0xB8u, 0xADu, 0xAAu, 0xA3u, 0xA4u,
+        0xF9u, 0xFEu, 0xF7u, 0xF0u, 0xE5u, 0xE2u, 0xEBu, 0xECu, 0xC1u, 0xC6u, 0xCFu, 0xC8u, 0xDDu, 0xDAu, 0xD3u, 0xD4u,
+        0x69u, 0x6Eu, 0x67u, 0x60u, 0x75u, 0x72u, 0x7Bu, 0x7Cu, 0x51u, 0x56u, 0x5Fu, 0x58u, 0x4Du, 0x4Au, 0x43u, 0x44u,
+        0x19u, 0x1Eu, 0x17u, 0x10u, 0x05u, 0x02u, 0x0Bu, 0x0Cu, 0x21u, 0x26u, 0x2Fu, 0x28u, 0x3Du, 0x3Au, 0x33u, 0x34u,
+        0x4Eu, 0x49u, 0x40u, 0x47u, 0x52u, 0x55u, 0x5Cu, 0x5Bu, 0x76u, 0x71u, 0x78u, 0x7Fu, 0x6Au, 0x6Du, 0x64u, 0x63u,
+        0x3Eu, 0x39u, 0x30u, 0x37u, 0x22u, 0x25u, 0x2Cu, 0x2Bu, 0x06u, 0x01u, 0x08u, 0x0Fu, 0x1Au, 0x1Du, 0x14u, 0x13u,
+        0xAEu, 0xA9u, 0xA0u, 0xA7u, 0xB2u, 0xB5u, 0xBCu, 0xBBu, 0x96u, 0x91u, 0x98u, 0x9Fu, 0x8Au, 0x8Du, 0x84u, 0x83u,
+        0xDEu, 0xD9u, 0xD0u, 0xD7u, 0xC2u, 0xC5u, 0xCCu, 0xCBu, 0xE6u, 0xE1u, 0xE8u, 0xEFu, 0xFAu, 0xFDu, 0xF4u, 0xF3u
+    };
+    static const qUINT16_t qCRC16_Table[ 256 ] = {
+        0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+        0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+        0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+        0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+        0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+        0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+        0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+        0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+        0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+        0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+        0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+        0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+        0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+        0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+        0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+        0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+        0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+        0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+        0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+        0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+        0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+        0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+        0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+        0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+        0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+        0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+        0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+        0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+        0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+        0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+        0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+        0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+    };
+    static const qUINT32_t qCRC32_Table[ 256 ] = {
+        0x00000000uL, 0x77073096uL, 0xEE0E612CuL, 0x990951BAuL, 0x076DC419uL, 0x706AF48FuL,
+        0xE963A535uL, 0x9E6495A3uL, 0x0EDB8832uL, 0x79DCB8A4uL, 0xE0D5E91EuL, 0x97D2D988uL,
+        0x09B64C2BuL, 0x7EB17CBDuL, 0xE7B82D07uL, 0x90BF1D91uL, 0x1DB71064uL, 0x6AB020F2uL,
+        0xF3B97148uL, 0x84BE41DEuL, 0x1ADAD47DuL, 0x6DDDE4EBuL, 0xF4D4B551uL, 0x83D385C7uL,
+        0x136C9856uL, 0x646BA8C0uL, 0xFD62F97AuL, 0x8A65C9ECuL, 0x14015C4FuL, 0x63066CD9uL,
+        0xFA0F3D63uL, 0x8D080DF5uL, 0x3B6E20C8uL, 0x4C69105EuL, 0xD56041E4uL, 0xA2677172uL,
+        0x3C03E4D1uL, 0x4B04D447uL, 0xD20D85FDuL, 0xA50AB56BuL, 0x35B5A8FAuL, 0x42B2986CuL,
+        0xDBBBC9D6uL, 0xACBCF940uL, 0x32D86CE3uL, 0x45DF5C75uL, 0xDCD60DCFuL, 0xABD13D59uL,
+        0x26D930ACuL, 0x51DE003AuL, 0xC8D75180uL, 0xBFD06116uL, 0x21B4F4B5uL, 0x56B3C423uL,
+        0xCFBA9599uL, 0xB8BDA50FuL, 0x2802B89EuL, 0x5F058808uL, 0xC60CD9B2uL, 0xB10BE924uL,
+        0x2F6F7C87uL, 0x58684C11uL, 0xC1611DABuL, 0xB6662D3DuL, 0x76DC4190uL, 0x01DB7106uL,
+        0x98D220BCuL, 0xEFD5102AuL, 0x71B18589uL, 0x06B6B51FuL, 0x9FBFE4A5uL, 0xE8B8D433uL,
+        0x7807C9A2uL, 0x0F00F934uL, 0x9609A88EuL, 0xE10E9818uL, 0x7F6A0DBBuL, 0x086D3D2DuL,
+        0x91646C97uL, 0xE6635C01uL, 0x6B6B51F4uL, 0x1C6C6162uL, 0x856530D8uL, 0xF262004EuL,
+        0x6C0695EDuL, 0x1B01A57BuL, 0x8208F4C1uL, 0xF50FC457uL, 0x65B0D9C6uL, 0x12B7E950uL,
+        0x8BBEB8EAuL, 0xFCB9887CuL, 0x62DD1DDFuL, 0x15DA2D49uL, 0x8CD37CF3uL, 0xFBD44C65uL,
+        0x4DB26158uL, 0x3AB551CEuL, 0xA3BC0074uL, 0xD4BB30E2uL, 0x4ADFA541uL, 0x3DD895D7uL,
+        0xA4D1C46DuL, 0xD3D6F4FBuL, 0x4369E96AuL, 0x346ED9FCuL, 0xAD678846uL, 0xDA60B8D0uL,
+        0x44042D73uL, 0x33031DE5uL, 0xAA0A4C5FuL, 0xDD0D7CC9uL, 0x5005713CuL, 0x270241AAuL,
+        0xBE0B1010uL, 0xC90C2086uL, 0x5768B525uL, 0x206F85B3uL, 0xB966D409uL, 0xCE61E49FuL,
+        0x5EDEF90EuL, 0x29D9C998uL, 0xB0D09822uL, 0xC7D7A8B4uL, 0x59B33D17uL, 0x2EB40D81uL,
+        0xB7BD5C3BuL, 0xC0BA6CADuL, 0xEDB88320uL, 0x9ABFB3B6uL, 0x03B6E20CuL, 0x74B1D29AuL,
+        0xEAD54739uL, 0x9DD277AFuL, 0x04DB2615uL, 0x73DC1683uL, 0xE3630B12uL, 0x94643B84uL,
+        0x0D6D6A3EuL, 0x7A6A5AA8uL, 0xE40ECF0BuL, 0x9309FF9DuL, 0x0A00AE27uL, 0x7D079EB1uL,
+        0xF00F9344uL, 0x8708A3D2uL, 0x1E01F268uL, 0x6906C2FEuL, 0xF762575DuL, 0x806567CBuL,
+        0x196C3671uL, 0x6E6B06E7uL, 0xFED41B76uL, 0x89D32BE0uL, 0x10DA7A5AuL, 0x67DD4ACCuL,
+        0xF9B9DF6FuL, 0x8EBEEFF9uL, 0x17B7BE43uL, 0x60B08ED5uL, 0xD6D6A3E8uL, 0xA1D1937EuL,
+        0x38D8C2C4uL, 0x4FDFF252uL, 0xD1BB67F1uL, 0xA6BC5767uL, 0x3FB506DDuL, 0x48B2364BuL,
+        0xD80D2BDAuL, 0xAF0A1B4CuL, 0x36034AF6uL, 0x41047A60uL, 0xDF60EFC3uL, 0xA867DF55uL,
+        0x316E8EEFuL, 0x4669BE79uL, 0xCB61B38CuL, 0xBC66831AuL, 0x256FD2A0uL, 0x5268E236uL,
+        0xCC0C7795uL, 0xBB0B4703uL, 0x220216B9uL, 0x5505262FuL, 0xC5BA3BBEuL, 0xB2BD0B28uL,
+        0x2BB45A92uL, 0x5CB36A04uL, 0xC2D7FFA7uL, 0xB5D0CF31uL, 0x2CD99E8BuL, 0x5BDEAE1DuL,
+        0x9B64C2B0uL, 0xEC63F226uL, 0x756AA39CuL, 0x026D930AuL, 0x9C0906A9uL, 0xEB0E363FuL,
+        0x72076785uL, 0x05005713uL, 0x95BF4A82uL, 0xE2B87A14uL, 0x7BB12BAEuL, 0x0CB61B38uL,
+        0x92D28E9BuL, 0xE5D5BE0DuL, 0x7CDCEFB7uL, 0x0BDBDF21uL, 0x86D3D2D4uL, 0xF1D4E242uL,
+        0x68DDB3F8uL, 0x1FDA836EuL, 0x81BE16CDuL, 0xF6B9265BuL, 0x6FB077E1uL, 0x18B74777uL,
+        0x88085AE6uL, 0xFF0F6A70uL, 0x66063BCAuL, 0x11010B5CuL, 0x8F659EFFuL, 0xF862AE69uL,
+        0x616BFFD3uL, 0x166CCF45uL, 0xA00AE278uL, 0xD70DD2EEuL, 0x4E048354uL, 0x3903B3C2uL,
+        0xA7672661uL, 0xD06016F7uL, 0x4969474DuL, 0x3E6E77DBuL, 0xAED16A4AuL, 0xD9D65ADCuL,
+        0x40DF0B66uL, 0x37D83BF0uL, 0xA9BCAE53uL, 0xDEBB9EC5uL, 0x47B2CF7FuL, 0x30B5FFE9uL,
+        0xBDBDF21CuL, 0xCABAC28AuL, 0x53B39330uL, 0x24B4A3A6uL, 0xBAD03605uL, 0xCDD70693uL,
+        0x54DE5729uL, 0x23D967BFuL, 0xB3667A2EuL, 0xC4614AB8uL, 0x5D681B02uL, 0x2A6F2B94uL,
+        0xB40BBE37uL, 0xC30C8EA1uL, 0x5A05DF1BuL, 0x2D02EF8DuL
+    };
+    #if ( QCRC_SLICE_BY_8 == 1 )
+    /*qCRC32_Slice[ k-1 ][ i ] : the CRC-32 contribution of byte <i> followed by <k> zero bytes*/
+    static const qUINT32_t qCRC32_Slice[ 7 ][ 256 ] = {
+        {
+            0x00000000uL, 0x191B3141uL, 0x32366282uL, 0x2B2D53C3uL, 0x646CC504uL, 0x7D77F445uL,
+            0x565AA786uL, 0x4F4196C7uL, 0xC8D98A08uL, 0xD1C2BB49uL, 0xFAEFE88AuL, 0xE3F4D9CBuL,
+            0xACB54F0CuL, 0xB5AE7E4DuL, 0x9E832D8EuL, 0x87981CCFuL, 0x4AC21251uL, 0x53D92310uL,
+            0x78F470D3uL, 0x61EF4192uL, 0x2EAED755uL, 0x37B5E614uL, 0x1C98B5D7uL, 0x05838496uL,
+            0x821B9859uL, 0x9B00A918uL, 0xB02DFADBuL, 0xA936CB9AuL, 0xE6775D5DuL, 0xFF6C6C1CuL,
+            0xD4413FDFuL, 0xCD5A0E9EuL, 0x958424A2uL, 0x8C9F15E3uL, 0xA7B24620uL, 0xBEA97761uL,
+            0xF1E8E1A6uL, 0xE8F3D0E7uL, 0xC3DE8324uL, 0xDAC5B265uL, 0x5D5DAEAAuL, 0x44469FEBuL,
+            0x6F6BCC28uL, 0x7670FD69uL, 0x39316BAEuL, 0x202A5AEFuL, 0x0B07092CuL, 0x121C386DuL,
+            0xDF4636F3uL, 0xC65D07B2uL, 0xED705471uL, 0xF46B6530uL, 0xBB2AF3F7uL, 0xA231C2B6uL,
+            0x891C9175uL, 0x9007A034uL, 0x179FBCFBuL, 0x0E848DBAuL, 0x25A9DE79uL, 0x3CB2EF38uL,
+            0x73F379FFuL, 0x6AE848BEuL, 0x41C51B7DuL, 0x58DE2A3CuL, 0xF0794F05uL, 0xE9627E44uL,
+            0xC24F2D87uL, 0xDB541CC6uL, 0x94158A01uL, 0x8D0EBB40uL, 0xA623E883uL, 0xBF38D9C2uL,
+            0x38A0C50DuL, 0x21BBF44CuL, 0x0A96A78FuL, 0x138D96CEuL, 0x5CCC0009uL, 0x45D73148uL,
+            0x6EFA628BuL, 0x77E153CAuL, 0xBABB5D54uL, 0xA3A06C15uL, 0x888D3FD6uL, 0x91960E97uL,
+            0xDED79850uL, 0xC7CCA911uL, 0xECE1FAD2uL, 0xF5FACB93uL, 0x7262D75CuL, 0x6B79E61DuL,
+            0x4054B5DEuL, 0x594F849FuL, 0x160E1258uL, 0x0F152319uL, 0x243870DAuL, 0x3D23419BuL,
+            0x65FD6BA7uL, 0x7CE65AE6uL, 0x57CB0925uL, 0x4ED03864uL, 0x0191AEA3uL, 0x188A9FE2uL,
+            0x33A7CC21uL, 0x2ABCFD60uL, 0xAD24E1AFuL, 0xB43FD0EEuL, 0x9F12832DuL, 0x8609B26CuL,
+            0xC94824ABuL, 0xD05315EAuL, 0xFB7E4629uL, 0xE2657768uL, 0x2F3F79F6uL, 0x362448B7uL,
+            0x1D091B74uL, 0x04122A35uL, 0x4B53BCF2uL, 0x52488DB3uL, 0x7965DE70uL, 0x607EEF31uL,
+            0xE7E6F3FEuL, 0xFEFDC2BFuL, 0xD5D0917CuL, 0xCCCBA03DuL, 0x838A36FAuL, 0x9A9107BBuL,
+            0xB1BC5478uL, 0xA8A76539uL, 0x3B83984BuL, 0x2298A90AuL, 0x09B5FAC9uL, 0x10AECB88uL,
+            0x5FEF5D4FuL, 0x46F46C0EuL, 0x6DD93FCDuL, 0x74C20E8CuL, 0xF35A1243uL, 0xEA412302uL,
+            0xC16C70C1uL, 0xD8774180uL, 0x9736D747uL, 0x8E2DE606uL, 0xA500B5C5uL, 0xBC1B8484uL,
+            0x71418A1AuL, 0x685ABB5BuL, 0x4377E898uL, 0x5A6CD9D9uL, 0x152D4F1EuL, 0x0C367E5FuL,
+            0x271B2D9CuL, 0x3E001CDDuL, 0xB9980012uL, 0xA0833153uL, 0x8BAE6290uL, 0x92B553D1uL,
+            0xDDF4C516uL, 0xC4EFF457uL, 0xEFC2A794uL, 0xF6D996D5uL, 0xAE07BCE9uL, 0xB71C8DA8uL,
+            0x9C31DE6BuL, 0x852AEF2AuL, 0xCA6B79EDuL, 0xD37048ACuL, 0xF85D1B6FuL, 0xE1462A2EuL,
+            0x66DE36E1uL, 0x7FC507A0uL, 0x54E85463uL, 0x4DF36522uL, 0x02B2F3E5uL, 0x1BA9C2A4uL,
+            0x30849167uL, 0x299FA026uL, 0xE4C5AEB8uL, 0xFDDE9FF9uL, 0xD6F3CC3AuL, 0xCFE8FD7BuL,
+            0x80A96BBCuL, 0x99B25AFDuL, 0xB29F093EuL, 0xAB84387FuL, 0x2C1C24B0uL, 0x350715F1uL,
+            0x1E2A4632uL, 0x07317773uL, 0x4870E1B4uL, 0x516BD0F5uL, 0x7A468336uL, 0x635DB277uL,
+            0xCBFAD74EuL, 0xD2E1E60FuL, 0xF9CCB5CCuL, 0xE0D7848DuL, 0xAF96124AuL, 0xB68D230BuL,
+            0x9DA070C8uL, 0x84BB4189uL, 0x03235D46uL, 0x1A386C07uL, 0x31153FC4uL, 0x280E0E85uL,
+            0x674F9842uL, 0x7E54A903uL, 0x5579FAC0uL, 0x4C62CB81uL, 0x8138C51FuL, 0x9823F45EuL,
+            0xB30EA79DuL, 0xAA1596DCuL, 0xE554001BuL, 0xFC4F315AuL, 0xD7626299uL, 0xCE7953D8uL,
+            0x49E14F17uL, 0x50FA7E56uL, 0x7BD72D95uL, 0x62CC1CD4uL, 0x2D8D8A13uL, 0x3496BB52uL,
+            0x1FBBE891uL, 0x06A0D9D0uL, 0x5E7EF3ECuL, 0x4765C2ADuL, 0x6C48916EuL, 0x7553A02FuL,
+            0x3A1236E8uL, 0x230907A9uL, 0x0824546AuL, 0x113F652BuL, 0x96A779E4uL, 0x8FBC48A5uL,
+            0xA4911B66uL, 0xBD8A2A27uL, 0xF2CBBCE0uL, 0xEBD08DA1uL, 0xC0FDDE62uL, 0xD9E6EF23uL,
+            0x14BCE1BDuL, 0x0DA7D0FCuL, 0x268A833FuL, 0x3F91B27EuL, 0x70D024B9uL, 0x69CB15F8uL,
+            0x42E6463BuL, 0x5BFD777AuL, 0xDC656BB5uL, 0xC57E5AF4uL, 0xEE530937uL, 0xF7483876uL,
+            0xB809AEB1uL, 0xA1129FF0uL, 0x8A3FCC33uL, 0x9324FD72uL
+        },
+        {
+            0x00000000uL, 0x01C26A37uL, 0x0384D46EuL, 0x0246BE59uL, 0x0709A8DCuL, 0x06CBC2EBuL,
+            0x048D7CB2uL, 0x054F1685uL, 0x0E1351B8uL, 0x0FD13B8FuL, 0x0D9785D6uL, 0x0C55EFE1uL,
+            0x091AF964uL, 0x08D89353uL, 0x0A9E2D0AuL, 0x0B5C473DuL, 0x1C26A370uL, 0x1DE4C947uL,
+            0x1FA2771EuL, 0x1E601D29uL, 0x1B2F0BACuL, 0x1AED619BuL, 0x18ABDFC2uL, 0x1969B5F5uL,
+            0x1235F2C8uL, 0x13F798FFuL, 0x11B126A6uL, 0x10734C91uL, 0x153C5A14uL, 0x14FE3023uL,
+            0x16B88E7AuL, 0x177AE44DuL, 0x384D46E0uL, 0x398F2CD7uL, 0x3BC9928EuL, 0x3A0BF8B9uL,
+            0x3F44EE3CuL, 0x3E86840BuL, 0x3CC03A52uL, 0x3D025065uL, 0x365E1758uL, 0x379C7D6FuL,
+            0x35DAC336uL, 0x3418A901uL, 0x3157BF84uL, 0x3095D5B3uL, 0x32D36BEAuL, 0x331101DDuL,
+            0x246BE590uL, 0x25A98FA7uL, 0x27EF31FEuL, 0x262D5BC9uL, 0x23624D4CuL, 0x22A0277BuL,
+            0x20E69922uL, 0x2124F315uL, 0x2A78B428uL, 0x2BBADE1FuL, 0x29FC6046uL, 0x283E0A71uL,
+            0x2D711CF4uL, 0x2CB376C3uL, 0x2EF5C89AuL, 0x2F37A2ADuL, 0x709A8DC0uL, 0x7158E7F7uL,
+            0x731E59AEuL, 0x72DC3399uL, 0x7793251CuL, 0x76514F2BuL, 0x7417F172uL, 0x75D59B45uL,
+            0x7E89DC78uL, 0x7F4BB64FuL, 0x7D0D0816uL, 0x7CCF6221uL, 0x798074A4uL, 0x78421E93uL,
+            0x7A04A0CAuL, 0x7BC6CAFDuL, 0x6CBC2EB0uL, 0x6D7E4487uL, 0x6F38FADEuL, 0x6EFA90E9uL,
+            0x6BB5866CuL, 0x6A77EC5BuL, 0x68315202uL, 0x69F33835uL, 0x62AF7F08uL, 0x636D153FuL,
+            0x612BAB66uL, 0x60E9C151uL, 0x65A6D7D4uL, 0x6464BDE3uL, 0x662203BAuL, 0x67E0698DuL,
+            0x48D7CB20uL, 0x4915A117uL, 0x4B531F4EuL, 0x4A917579uL, 0x4FDE63FCuL, 0x4E1C09CBuL,
+            0x4C5AB792uL, 0x4D98DDA5uL, 0x46C49A98uL, 0x4706F0AFuL, 0x45404EF6uL, 0x448224C1uL,
+            0x41CD3244uL, 0x400F5873uL, 0x4249E62AuL, 0x438B8C1DuL, 0x54F16850uL, 0x55330267uL,
+            0x5775BC3EuL, 0x56B7D609uL, 0x53F8C08CuL, 0x523AAABBuL, 0x507C14E2uL, 0x51BE7ED5uL,
+            0x5AE239E8uL, 0x5B2053DFuL, 0x5966ED86uL, 0x58A487B1uL, 0x5DEB9134uL, 0x5C29FB03uL,
+            0x5E6F455AuL, 0x5FAD2F6DuL, 0xE1351B80uL, 0xE0F771B7uL, 0xE2B1CFEEuL, 0xE373A5D9uL,
+            0xE63CB35CuL, 0xE7FED96BuL, 0xE5B86732uL, 0xE47A0D05uL, 0xEF264A38uL, 0xEEE4200FuL,
+            0xECA29E56uL, 0xED60F461uL, 0xE82FE2E4uL, 0xE9ED88D3uL, 0xEBAB368AuL, 0xEA695CBDuL,
+            0xFD13B8F0uL, 0xFCD1D2C7uL, 0xFE976C9EuL, 0xFF5506A9uL, 0xFA1A102CuL, 0xFBD87A1BuL,
+            0xF99EC442uL, 0xF85CAE75uL, 0xF300E948uL, 0xF2C2837FuL, 0xF0843D26uL, 0xF1465711uL,
+            0xF4094194uL, 0xF5CB2BA3uL, 0xF78D95FAuL, 0xF64FFFCDuL, 0xD9785D60uL, 0xD8BA3757uL,
+            0xDAFC890EuL, 0xDB3EE339uL, 0xDE71F5BCuL, 0xDFB39F8BuL, 0xDDF521D2uL, 0xDC374BE5uL,
+            0xD76B0CD8uL, 0xD6A966EFuL, 0xD4EFD8B6uL, 0xD52DB281uL, 0xD062A404uL, 0xD1A0CE33uL,
+            0xD3E6706AuL, 0xD2241A5DuL, 0xC55EFE10uL, 0xC49C9427uL, 0xC6DA2A7EuL, 0xC7184049uL,
+            0xC25756CCuL, 0xC3953CFBuL, 0xC1D382A2uL, 0xC011E895uL, 0xCB4DAFA8uL, 0xCA8FC59FuL,
+            0xC8C97BC6uL, 0xC90B11F1uL, 0xCC440774uL, 0xCD866D43uL, 0xCFC0D31AuL, 0xCE02B92DuL,
+            0x91AF9640uL, 0x906DFC77uL, 0x922B422EuL, 0x93E92819uL, 0x96A63E9CuL, 0x976454ABuL,
+            0x9522EAF2uL, 0x94E080C5uL, 0x9FBCC7F8uL, 0x9E7EADCFuL, 0x9C381396uL, 0x9DFA79A1uL,
+            0x98B56F24uL, 0x99770513uL, 0x9B31BB4AuL, 0x9AF3D17DuL, 0x8D893530uL, 0x8C4B5F07uL,
+            0x8E0DE15EuL, 0x8FCF8B69uL, 0x8A809DECuL, 0x8B42F7DBuL, 0x89044982uL, 0x88C623B5uL,
+            0x839A6488uL, 0x82580EBFuL, 0x801EB0E6uL, 0x81DCDAD1uL, 0x8493CC54uL, 0x8551A663uL,
+            0x8717183AuL, 0x86D5720DuL, 0xA9E2D0A0uL, 0xA820BA97uL, 0xAA6604CEuL, 0xABA46EF9uL,
+            0xAEEB787CuL, 0xAF29124BuL, 0xAD6FAC12uL, 0xACADC625uL, 0xA7F18118uL, 0xA633EB2FuL,
+            0xA4755576uL, 0xA5B73F41uL, 0xA0F829C4uL, 0xA13A43F3uL, 0xA37CFDAAuL, 0xA2BE979DuL,
+            0xB5C473D0uL, 0xB40619E7uL, 0xB640A7BEuL, 0xB782CD89uL, 0xB2CDDB0CuL, 0xB30FB13BuL,
+            0xB1490F62uL, 0xB08B6555uL, 0xBBD72268uL, 0xBA15485FuL, 0xB853F606uL, 0xB9919C31uL,
+            0xBCDE8AB4uL, 0xBD1CE083uL, 0xBF5A5EDAuL, 0xBE9834EDuL
+        },
+        {
+            0x00000000uL, 0xB8BC6765uL, 0xAA09C88BuL, 0x12B5AFEEuL, 0x8F629757uL, 0x37DEF032uL,
+            0x256B5FDCuL, 0x9DD738B9uL, 0xC5B428EFuL, 0x7D084F8AuL, 0x6FBDE064uL, 0xD7018701uL,
+            0x4AD6BFB8uL, 0xF26AD8DDuL, 0xE0DF7733uL, 0x58631056uL, 0x5019579FuL, 0xE8A530FAuL,
+            0xFA109F14uL, 0x42ACF871uL, 0xDF7BC0C8uL, 0x67C7A7ADuL, 0x75720843uL, 0xCDCE6F26uL,
+            0x95AD7F70uL, 0x2D111815uL, 0x3FA4B7FBuL, 0x8718D09EuL, 0x1ACFE827uL, 0xA2738F42uL,
+            0xB0C620ACuL, 0x087A47C9uL, 0xA032AF3EuL, 0x188EC85BuL, 0x0A3B67B5uL, 0xB28700D0uL,
+            0x2F503869uL, 0x97EC5F0CuL, 0x8559F0E2uL, 0x3DE59787uL, 0x658687D1uL, 0xDD3AE0B4uL,
+            0xCF8F4F5AuL, 0x7733283FuL, 0xEAE41086uL, 0x525877E3uL, 0x40EDD80DuL, 0xF851BF68uL,
+            0xF02BF8A1uL, 0x48979FC4uL, 0x5A22302AuL, 0xE29E574FuL, 0x7F496FF6uL, 0xC7F50893uL,
+            0xD540A77DuL, 0x6DFCC018uL, 0x359FD04EuL, 0x8D23B72BuL, 0x9F9618C5uL, 0x272A7FA0uL,
+            0xBAFD4719uL, 0x0241207CuL, 0x10F48F92uL, 0xA848E8F7uL, 0x9B14583DuL, 0x23A83F58uL,
+            0x311D90B6uL, 0x89A1F7D3uL, 0x1476CF6AuL, 0xACCAA80FuL, 0xBE7F07E1uL, 0x06C36084uL,
+            0x5EA070D2uL, 0xE61C17B7uL, 0xF4A9B859uL, 0x4C15DF3CuL, 0xD1C2E785uL, 0x697E80E0uL,
+            0x7BCB2F0EuL, 0xC377486BuL, 0xCB0D0FA2uL, 0x73B168C7uL, 0x6104C729uL, 0xD9B8A04CuL,
+            0x446F98F5uL, 0xFCD3FF90uL, 0xEE66507EuL, 0x56DA371BuL, 0x0EB9274DuL, 0xB6054028uL,
+            0xA4B0EFC6uL, 0x1C0C88A3uL, 0x81DBB01AuL, 0x3967D77FuL, 0x2BD27891uL, 0x936E1FF4uL,
+            0x3B26F703uL, 0x839A9066uL, 0x912F3F88uL, 0x299358EDuL, 0xB4446054uL, 0x0CF80731uL,
+            0x1E4DA8DFuL, 0xA6F1CFBAuL, 0xFE92DFECuL, 0x462EB889uL, 0x549B1767uL, 0xEC277002uL,
+            0x71F048BBuL, 0xC94C2FDEuL, 0xDBF98030uL, 0x6345E755uL, 0x6B3FA09CuL, 0xD383C7F9uL,
+            0xC1366817uL, 0x798A0F72uL, 0xE45D37CBuL, 0x5CE150AEuL, 0x4E54FF40uL, 0xF6E89825uL,
+            0xAE8B8873uL, 0x1637EF16uL, 0x048240F8uL, 0xBC3E279DuL, 0x21E91F24uL, 0x99557841uL,
+            0x8BE0D7AFuL, 0x335CB0CAuL, 0xED59B63BuL, 0x55E5D15EuL, 0x47507EB0uL, 0xFFEC19D5uL,
+            0x623B216CuL, 0xDA874609uL, 0xC832E9E7uL, 0x708E8E82uL, 0x28ED9ED4uL, 0x9051F9B1uL,
+            0x82E4565FuL, 0x3A58313AuL, 0xA78F0983uL, 0x1F336EE6uL, 0x0D86C108uL, 0xB53AA66DuL,
+            0xBD40E1A4uL, 0x05FC86C1uL, 0x1749292FuL, 0xAFF54E4AuL, 0x322276F3uL, 0x8A9E1196uL,
+            0x982BBE78uL, 0x2097D91DuL, 0x78F4C94BuL, 0xC048AE2EuL, 0xD2FD01C0uL, 0x6A4166A5uL,
+            0xF7965E1CuL, 0x4F2A3979uL, 0x5D9F9697uL, 0xE523F1F2uL, 0x4D6B1905uL, 0xF5D77E60uL,
+            0xE762D18EuL, 0x5FDEB6EBuL, 0xC2098E52uL, 0x7AB5E937uL, 0x680046D9uL, 0xD0BC21BCuL,
+            0x88DF31EAuL, 0x3063568FuL, 0x22D6F961uL, 0x9A6A9E04uL, 0x07BDA6BDuL, 0xBF01C1D8uL,
+            0xADB46E36uL, 0x15080953uL, 0x1D724E9AuL, 0xA5CE29FFuL, 0xB77B8611uL, 0x0FC7E174uL,
+            0x9210D9CDuL, 0x2AACBEA8uL, 0x38191146uL, 0x80A57623uL, 0xD8C66675uL, 0x607A0110uL,
+            0x72CFAEFEuL, 0xCA73C99BuL, 0x57A4F122uL, 0xEF189647uL, 0xFDAD39A9uL, 0x45115ECCuL,
+            0x764DEE06uL, 0xCEF18963uL, 0xDC44268DuL, 0x64F841E8uL, 0xF92F7951uL, 0x41931E34uL,
+            0x5326B1DAuL, 0xEB9AD6BFuL, 0xB3F9C6E9uL, 0x0B45A18CuL, 0x19F00E62uL, 0xA14C6907uL,
+            0x3C9B51BEuL, 0x842736DBuL, 0x96929935uL, 0x2E2EFE50uL, 0x2654B999uL, 0x9EE8DEFCuL,
+            0x8C5D7112uL, 0x34E11677uL, 0xA9362ECEuL, 0x118A49ABuL, 0x033FE645uL, 0xBB838120uL,
+            0xE3E09176uL, 0x5B5CF613uL, 0x49E959FDuL, 0xF1553E98uL, 0x6C820621uL, 0xD43E6144uL,
+            0xC68BCEAAuL, 0x7E37A9CFuL, 0xD67F4138uL, 0x6EC3265DuL, 0x7C7689B3uL, 0xC4CAEED6uL,
+            0x591DD66FuL, 0xE1A1B10AuL, 0xF3141EE4uL, 0x4BA87981uL, 0x13CB69D7uL, 0xAB770EB2uL,
+            0xB9C2A15CuL, 0x017EC639uL, 0x9CA9FE80uL, 0x241599E5uL, 0x36A0360BuL, 0x8E1C516EuL,
+            0x866616A7uL, 0x3EDA71C2uL, 0x2C6FDE2CuL, 0x94D3B949uL, 0x090481F0uL, 0xB1B8E695uL,
+            0xA30D497BuL, 0x1BB12E1EuL, 0x43D23E48uL, 0xFB6E592DuL, 0xE9DBF6C3uL, 0x516791A6uL,
+            0xCCB0A91FuL, 0x740CCE7AuL, 0x66B96194uL, 0xDE0506F1uL
+        },
+        {
+            0x00000000uL, 0x3D6029B0uL, 0x7AC05360uL, 0x47A07AD0uL, 0xF580A6C0uL, 0xC8E08F70uL,
+            0x8F40F5A0uL, 0xB220DC10uL, 0x30704BC1uL, 0x0D106271uL, 0x4AB018A1uL, 0x77D03111uL,
+            0xC5F0ED01uL, 0xF890C4B1uL, 0xBF30BE61uL, 0x825097D1uL, 0x60E09782uL, 0x5D80BE32uL,
+            0x1A20C4E2uL, 0x2740ED52uL, 0x95603142uL, 0xA80018F2uL, 0xEFA06222uL, 0xD2C04B92uL,
+            0x5090DC43uL, 0x6DF0F5F3uL, 0x2A508F23uL, 0x1730A693uL, 0xA5107A83uL, 0x98705333uL,
+            0xDFD029E3uL, 0xE2B00053uL, 0xC1C12F04uL, 0xFCA106B4uL, 0xBB017C64uL, 0x866155D4uL,
+            0x344189C4uL, 0x0921A074uL, 0x4E81DAA4uL, 0x73E1F314uL, 0xF1B164C5uL, 0xCCD14D75uL,
+            0x8B7137A5uL, 0xB6111E15uL, 0x0431C205uL, 0x3951EBB5uL, 0x7EF19165uL, 0x4391B8D5uL,
+            0xA121B886uL, 0x9C419136uL, 0xDBE1EBE6uL, 0xE681C256uL, 0x54A11E46uL, 0x69C137F6uL,
+            0x2E614D26uL, 0x13016496uL, 0x9151F347uL, 0xAC31DAF7uL, 0xEB91A027uL, 0xD6F18997uL,
+            0x64D15587uL, 0x59B17C37uL, 0x1E1106E7uL, 0x23712F57uL, 0x58F35849uL, 0x659371F9uL,
+            0x22330B29uL, 0x1F532299uL, 0xAD73FE89uL, 0x9013D739uL, 0xD7B3ADE9uL, 0xEAD38459uL,
+            0x68831388uL, 0x55E33A38uL, 0x124340E8uL, 0x2F236958uL, 0x9D03B548uL, 0xA0639CF8uL,
+            0xE7C3E628uL, 0xDAA3CF98uL, 0x3813CFCBuL, 0x0573E67BuL, 0x42D39CABuL, 0x7FB3B51BuL,
+            0xCD93690BuL, 0xF0F340BBuL, 0xB7533A6BuL, 0x8A3313DBuL, 0x0863840AuL, 0x3503ADBAuL,
+            0x72A3D76AuL, 0x4FC3FEDAuL, 0xFDE322CAuL, 0xC0830B7AuL, 0x872371AAuL, 0xBA43581AuL,
+            0x9932774DuL, 0xA4525EFDuL, 0xE3F2242DuL, 0xDE920D9DuL, 0x6CB2D18DuL, 0x51D2F83DuL,
+            0x167282EDuL, 0x2B12AB5DuL, 0xA9423C8CuL, 0x9422153CuL, 0xD3826FECuL, 0xEEE2465CuL,
+            0x5CC29A4CuL, 0x61A2B3FCuL, 0x2602C92CuL, 0x1B62E09CuL, 0xF9D2E0CFuL, 0xC4B2C97FuL,
+            0x8312B3AFuL, 0xBE729A1FuL, 0x0C52460FuL, 0x31326FBFuL, 0x7692156FuL, 0x4BF23CDFuL,
+            0xC9A2AB0EuL, 0xF4C282BEuL, 0xB362F86EuL, 0x8E02D1DEuL, 0x3C220DCEuL, 0x0142247EuL,
+            0x46E25EAEuL, 0x7B82771EuL, 0xB1E6B092uL, 0x8C869922uL, 0xCB26E3F2uL, 0xF646CA42uL,
+            0x44661652uL, 0x79063FE2uL, 0x3EA64532uL, 0x03C66C82uL, 0x8196FB53uL, 0xBCF6D2E3uL,
+            0xFB56A833uL, 0xC6368183uL, 0x74165D93uL, 0x49767423uL, 0x0ED60EF3uL, 0x33B62743uL,
+            0xD1062710uL, 0xEC660EA0uL, 0xABC67470uL, 0x96A65DC0uL, 0x248681D0uL, 0x19E6A860uL,
+            0x5E46D2B0uL, 0x6326FB00uL, 0xE1766CD1uL, 0xDC164561uL, 0x9BB63FB1uL, 0xA6D61601uL,
+            0x14F6CA11uL, 0x2996E3A1uL, 0x6E369971uL, 0x5356B0C1uL, 0x70279F96uL, 0x4D47B626uL,
+            0x0AE7CCF6uL, 0x3787E546uL, 0x85A73956uL, 0xB8C710E6uL, 0xFF676A36uL, 0xC2074386uL,
+            0x4057D457uL, 0x7D37FDE7uL, 0x3A978737uL, 0x07F7AE87uL, 0xB5D77297uL, 0x88B75B27uL,
+            0xCF1721F7uL, 0xF2770847uL, 0x10C70814uL, 0x2DA721A4uL, 0x6A075B74uL, 0x576772C4uL,
+            0xE547AED4uL, 0xD8278764uL, 0x9F87FDB4uL, 0xA2E7D404uL, 0x20B743D5uL, 0x1DD76A65uL,
+            0x5A7710B5uL, 0x67173905uL, 0xD537E515uL, 0xE857CCA5uL, 0xAFF7B675uL, 0x92979FC5uL,
+            0xE915E8DBuL, 0xD475C16BuL, 0x93D5BBBBuL, 0xAEB5920BuL, 0x1C954E1BuL, 0x21F567ABuL,
+            0x66551D7BuL, 0x5B3534CBuL, 0xD965A31AuL, 0xE4058AAAuL, 0xA3A5F07AuL, 0x9EC5D9CAuL,
+            0x2CE505DAuL, 0x11852C6AuL, 0x562556BAuL, 0x6B457F0AuL, 0x89F57F59uL, 0xB49556E9uL,
+            0xF3352C39uL, 0xCE550589uL, 0x7C75D999uL, 0x4115F029uL, 0x06B58AF9uL, 0x3BD5A349uL,
+            0xB9853498uL, 0x84E51D28uL, 0xC34567F8uL, 0xFE254E48uL, 0x4C059258uL, 0x7165BBE8uL,
+            0x36C5C138uL, 0x0BA5E888uL, 0x28D4C7DFuL, 0x15B4EE6FuL, 0x521494BFuL, 0x6F74BD0FuL,
+            0xDD54611FuL, 0xE03448AFuL, 0xA794327FuL, 0x9AF41BCFuL, 0x18A48C1EuL, 0x25C4A5AEuL,
+            0x6264DF7EuL, 0x5F04F6CEuL, 0xED242ADEuL, 0xD044036EuL, 0x97E479BEuL, 0xAA84500EuL,
+            0x4834505DuL, 0x755479EDuL, 0x32F4033DuL, 0x0F942A8DuL, 0xBDB4F69DuL, 0x80D4DF2DuL,
+            0xC774A5FDuL, 0xFA148C4DuL, 0x78441B9CuL, 0x4524322CuL, 0x028448FCuL, 0x3FE4614CuL,
+            0x8DC4BD5CuL, 0xB0A494ECuL, 0xF704EE3CuL, 0xCA64C78CuL
+        },
+        {
+            0x00000000uL, 0xCB5CD3A5uL, 0x4DC8A10BuL, 0x869472AEuL, 0x9B914216uL, 0x50CD91B3uL,
+            0xD659E31DuL, 0x1D0530B8uL, 0xEC53826DuL, 0x270F51C8uL, 0xA19B2366uL, 0x6AC7F0C3uL,
+            0x77C2C07BuL, 0xBC9E13DEuL, 0x3A0A6170uL, 0xF156B2D5uL, 0x03D6029BuL, 0xC88AD13EuL,
+            0x4E1EA390uL, 0x85427035uL, 0x9847408DuL, 0x531B9328uL, 0xD58FE186uL, 0x1ED33223uL,
+            0xEF8580F6uL, 0x24D95353uL, 0xA24D21FDuL, 0x6911F258uL, 0x7414C2E0uL, 0xBF481145uL,
+            0x39DC63EBuL, 0xF280B04EuL, 0x07AC0536uL, 0xCCF0D693uL, 0x4A64A43DuL, 0x81387798uL,
+            0x9C3D4720uL, 0x57619485uL, 0xD1F5E62BuL, 0x1AA9358EuL, 0xEBFF875BuL, 0x20A354FEuL,
+            0xA6372650uL, 0x6D6BF5F5uL, 0x706EC54DuL, 0xBB3216E8uL, 0x3DA66446uL, 0xF6FAB7E3uL,
+            0x047A07ADuL, 0xCF26D408uL, 0x49B2A6A6uL, 0x82EE7503uL, 0x9FEB45BBuL, 0x54B7961EuL,
+            0xD223E4B0uL, 0x197F3715uL, 0xE82985C0uL, 0x23755665uL, 0xA5E124CBuL, 0x6EBDF76EuL,
+            0x73B8C7D6uL, 0xB8E41473uL, 0x3E7066DDuL, 0xF52CB578uL, 0x0F580A6CuL, 0xC404D9C9uL,
+            0x4290AB67uL, 0x89CC78C2uL, 0x94C9487AuL, 0x5F959BDFuL, 0xD901E971uL, 0x125D3AD4uL,
+            0xE30B8801uL, 0x28575BA4uL, 0xAEC3290AuL, 0x659FFAAFuL, 0x789ACA17uL, 0xB3C619B2uL,
+            0x35526B1CuL, 0xFE0EB8B9uL, 0x0C8E08F7uL, 0xC7D2DB52uL, 0x4146A9FCuL, 0x8A1A7A59uL,
+            0x971F4AE1uL, 0x5C439944uL, 0xDAD7EBEAuL, 0x118B384FuL, 0xE0DD8A9AuL, 0x2B81593FuL,
+            0xAD152B91uL, 0x6649F834uL, 0x7B4CC88CuL, 0xB0101B29uL, 0x36846987uL, 0xFDD8BA22uL,
+            0x08F40F5AuL, 0xC3A8DCFFuL, 0x453CAE51uL, 0x8E607DF4uL, 0x93654D4CuL, 0x58399EE9uL,
+            0xDEADEC47uL, 0x15F13FE2uL, 0xE4A78D37uL, 0x2FFB5E92uL, 0xA96F2C3CuL, 0x6233FF99uL,
+            0x7F36CF21uL, 0xB46A1C84uL, 0x32FE6E2AuL, 0xF9A2BD8FuL, 0x0B220DC1uL, 0xC07EDE64uL,
+            0x46EAACCAuL, 0x8DB67F6FuL, 0x90B34FD7uL, 0x5BEF9C72uL, 0xDD7BEEDCuL, 0x16273D79uL,
+            0xE7718FACuL, 0x2C2D5C09uL, 0xAAB92EA7uL, 0x61E5FD02uL, 0x7CE0CDBAuL, 0xB7BC1E1FuL,
+            0x31286CB1uL, 0xFA74BF14uL, 0x1EB014D8uL, 0xD5ECC77DuL, 0x5378B5D3uL, 0x98246676uL,
+            0x852156CEuL, 0x4E7D856BuL, 0xC8E9F7C5uL, 0x03B52460uL, 0xF2E396B5uL, 0x39BF4510uL,
+            0xBF2B37BEuL, 0x7477E41BuL, 0x6972D4A3uL, 0xA22E0706uL, 0x24BA75A8uL, 0xEFE6A60DuL,
+            0x1D661643uL, 0xD63AC5E6uL, 0x50AEB748uL, 0x9BF264EDuL, 0x86F75455uL, 0x4DAB87F0uL,
+            0xCB3FF55EuL, 0x006326FBuL, 0xF135942EuL, 0x3A69478BuL, 0xBCFD3525uL, 0x77A1E680uL,
+            0x6AA4D638uL, 0xA1F8059DuL, 0x276C7733uL, 0xEC30A496uL, 0x191C11EEuL, 0xD240C24BuL,
+            0x54D4B0E5uL, 0x9F886340uL, 0x828D53F8uL, 0x49D1805DuL, 0xCF45F2F3uL, 0x04192156uL,
+            0xF54F9383uL, 0x3E134026uL, 0xB8873288uL, 0x73DBE12DuL, 0x6EDED195uL, 0xA5820230uL,
+            0x2316709EuL, 0xE84AA33BuL, 0x1ACA1375uL, 0xD196C0D0uL, 0x5702B27EuL, 0x9C5E61DBuL,
+            0x815B5163uL, 0x4A0782C6uL, 0xCC93F068uL, 0x07CF23CDuL, 0xF6999118uL, 0x3DC542BDuL,
+            0xBB513013uL, 0x700DE3B6uL, 0x6D08D30EuL, 0xA65400ABuL, 0x20C07205uL, 0xEB9CA1A0uL,
+            0x11E81EB4uL, 0xDAB4CD11uL, 0x5C20BFBFuL, 0x977C6C1AuL, 0x8A795CA2uL, 0x41258F07uL,
+            0xC7B1FDA9uL, 0x0CED2E0CuL, 0xFDBB9CD9uL, 0x36E74F7CuL, 0xB0733DD2uL, 0x7B2FEE77uL,
+            0x662ADECFuL, 0xAD760D6AuL, 0x2BE27FC4uL, 0xE0BEAC61uL, 0x123E1C2FuL, 0xD962CF8AuL,
+            0x5FF6BD24uL, 0x94AA6E81uL, 0x89AF5E39uL, 0x42F38D9CuL, 0xC467FF32uL, 0x0F3B2C97uL,
+            0xFE6D9E42uL, 0x35314DE7uL, 0xB3A53F49uL, 0x78F9ECECuL, 0x65FCDC54uL, 0xAEA00FF1uL,
+            0x28347D5FuL, 0xE368AEFAuL, 0x16441B82uL, 0xDD18C827uL, 0x5B8CBA89uL, 0x90D0692CuL,
+            0x8DD55994uL, 0x46898A31uL, 0xC01DF89FuL, 0x0B412B3AuL, 0xFA1799EFuL, 0x314B4A4AuL,
+            0xB7DF38E4uL, 0x7C83EB41uL, 0x6186DBF9uL, 0xAADA085CuL, 0x2C4E7AF2uL, 0xE712A957uL,
+            0x15921919uL, 0xDECECABCuL, 0x585AB812uL, 0x93066BB7uL, 0x8E035B0FuL, 0x455F88AAuL,
+            0xC3CBFA04uL, 0x089729A1uL, 0xF9C19B74uL, 0x329D48D1uL, 0xB4093A7FuL, 0x7F55E9DAuL,
+            0x6250D962uL, 0xA90C0AC7uL, 0x2F987869uL, 0xE4C4ABCCuL
+        },
+        {
+            0x00000000uL, 0xA6770BB4uL, 0x979F1129uL, 0x31E81A9DuL, 0xF44F2413uL, 0x52382FA7uL,
+            0x63D0353AuL, 0xC5A73E8EuL, 0x33EF4E67uL, 0x959845D3uL, 0xA4705F4EuL, 0x020754FAuL,
+            0xC7A06A74uL, 0x61D761C0uL, 0x503F7B5DuL, 0xF64870E9uL, 0x67DE9CCEuL, 0xC1A9977AuL,
+            0xF0418DE7uL, 0x56368653uL, 0x9391B8DDuL, 0x35E6B369uL, 0x040EA9F4uL, 0xA279A240uL,
+            0x5431D2A9uL, 0xF246D91DuL, 0xC3AEC380uL, 0x65D9C834uL, 0xA07EF6BAuL, 0x0609FD0EuL,
+            0x37E1E793uL, 0x9196EC27uL, 0xCFBD399CuL, 0x69CA3228uL, 0x582228B5uL, 0xFE552301uL,
+            0x3BF21D8FuL, 0x9D85163BuL, 0xAC6D0CA6uL, 0x0A1A0712uL, 0xFC5277FBuL, 0x5A257C4FuL,
+            0x6BCD66D2uL, 0xCDBA6D66uL, 0x081D53E8uL, 0xAE6A585CuL, 0x9F8242C1uL, 0x39F54975uL,
+            0xA863A552uL, 0x0E14AEE6uL, 0x3FFCB47BuL, 0x998BBFCFuL, 0x5C2C8141uL, 0xFA5B8AF5uL,
+            0xCBB39068uL, 0x6DC49BDCuL, 0x9B8CEB35uL, 0x3DFBE081uL, 0x0C13FA1CuL, 0xAA64F1A8uL,
+            0x6FC3CF26uL, 0xC9B4C492uL, 0xF85CDE0FuL, 0x5E2BD5BBuL, 0x440B7579uL, 0xE27C7ECDuL,
+            0xD3946450uL, 0x75E36FE4uL, 0xB044516AuL, 0x16335ADEuL, 0x27DB4043uL, 0x81AC4BF7uL,
+            0x77E43B1EuL, 0xD19330AAuL, 0xE07B2A37uL, 0x460C2183uL, 0x83AB1F0DuL, 0x25DC14B9uL,
+            0x14340E24uL, 0xB2430590uL, 0x23D5E9B7uL, 0x85A2E203uL, 0xB44AF89EuL, 0x123DF32AuL,
+            0xD79ACDA4uL, 0x71EDC610uL, 0x4005DC8DuL, 0xE672D739uL, 0x103AA7D0uL, 0xB64DAC64uL,
+            0x87A5B6F9uL, 0x21D2BD4DuL, 0xE47583C3uL, 0x42028877uL, 0x73EA92EAuL, 0xD59D995EuL,
+            0x8BB64CE5uL, 0x2DC14751uL, 0x1C295DCCuL, 0xBA5E5678uL, 0x7FF968F6uL, 0xD98E6342uL,
+            0xE86679DFuL, 0x4E11726BuL, 0xB8590282uL, 0x1E2E0936uL, 0x2FC613ABuL, 0x89B1181FuL,
+            0x4C162691uL, 0xEA612D25uL, 0xDB8937B8uL, 0x7DFE3C0CuL, 0xEC68D02BuL, 0x4A1FDB9FuL,
+            0x7BF7C102uL, 0xDD80CAB6uL, 0x1827F438uL, 0xBE50FF8CuL, 0x8FB8E511uL, 0x29CFEEA5uL,
+            0xDF879E4CuL, 0x79F095F8uL, 0x48188F65uL, 0xEE6F84D1uL, 0x2BC8BA5FuL, 0x8DBFB1EBuL,
+            0xBC57AB76uL, 0x1A20A0C2uL, 0x8816EAF2uL, 0x2E61E146uL, 0x1F89FBDBuL, 0xB9FEF06FuL,
+            0x7C59CEE1uL, 0xDA2EC555uL, 0xEBC6DFC8uL, 0x4DB1D47CuL, 0xBBF9A495uL, 0x1D8EAF21uL,
+            0x2C66B5BCuL, 0x8A11BE08uL, 0x4FB68086uL, 0xE9C18B32uL, 0xD82991AFuL, 0x7E5E9A1BuL,
+            0xEFC8763CuL, 0x49BF7D88uL, 0x78576715uL, 0xDE206CA1uL, 0x1B87522FuL, 0xBDF0599BuL,
+            0x8C184306uL, 0x2A6F48B2uL, 0xDC27385BuL, 0x7A5033EFuL, 0x4BB82972uL, 0xEDCF22C6uL,
+            0x28681C48uL, 0x8E1F17FCuL, 0xBFF70D61uL, 0x198006D5uL, 0x47ABD36EuL, 0xE1DCD8DAuL,
+            0xD034C247uL, 0x7643C9F3uL, 0xB3E4F77DuL, 0x1593FCC9uL, 0x247BE654uL, 0x820CEDE0uL,
+            0x74449D09uL, 0xD23396BDuL, 0xE3DB8C20uL, 0x45AC8794uL, 0x800BB91AuL, 0x267CB2AEuL,
+            0x1794A833uL, 0xB1E3A387uL, 0x20754FA0uL, 0x86024414uL, 0xB7EA5E89uL, 0x119D553DuL,
+            0xD43A6BB3uL, 0x724D6007uL, 0x43A57A9AuL, 0xE5D2712EuL, 0x139A01C7uL, 0xB5ED0A73uL,
+            0x840510EEuL, 0x22721B5AuL, 0xE7D525D4uL, 0x41A22E60uL, 0x704A34FDuL, 0xD63D3F49uL,
+            0xCC1D9F8BuL, 0x6A6A943FuL, 0x5B828EA2uL, 0xFDF58516uL, 0x3852BB98uL, 0x9E25B02CuL,
+            0xAFCDAAB1uL, 0x09BAA105uL, 0xFFF2D1ECuL, 0x5985DA58uL, 0x686DC0C5uL, 0xCE1ACB71uL,
+            0x0BBDF5FFuL, 0xADCAFE4BuL, 0x9C22E4D6uL, 0x3A55EF62uL, 0xABC30345uL, 0x0DB408F1uL,
+            0x3C5C126CuL, 0x9A2B19D8uL, 0x5F8C2756uL, 0xF9FB2CE2uL, 0xC813367FuL, 0x6E643DCBuL,
+            0x982C4D22uL, 0x3E5B4696uL, 0x0FB35C0BuL, 0xA9C457BFuL, 0x6C636931uL, 0xCA146285uL,
+            0xFBFC7818uL, 0x5D8B73ACuL, 0x03A0A617uL, 0xA5D7ADA3uL, 0x943FB73EuL, 0x3248BC8AuL,
+            0xF7EF8204uL, 0x519889B0uL, 0x6070932DuL, 0xC6079899uL, 0x304FE870uL, 0x9638E3C4uL,
+            0xA7D0F959uL, 0x01A7F2EDuL, 0xC400CC63uL, 0x6277C7D7uL, 0x539FDD4AuL, 0xF5E8D6FEuL,
+            0x647E3AD9uL, 0xC209316DuL, 0xF3E12BF0uL, 0x55962044uL, 0x90311ECAuL, 0x3646157EuL,
+            0x07AE0FE3uL, 0xA1D90457uL, 0x579174BEuL, 0xF1E67F0AuL, 0xC00E6597uL, 0x66796E23uL,
+            0xA3DE50ADuL, 0x05A95B19uL, 0x34414184uL, 0x92364A30uL
+        },
+        {
+            0x00000000uL, 0xCCAA009EuL, 0x4225077DuL, 0x8E8F07E3uL, 0x844A0EFAuL, 0x48E00E64uL,
+            0xC66F0987uL, 0x0AC50919uL, 0xD3E51BB5uL, 0x1F4F1B2BuL, 0x91C01CC8uL, 0x5D6A1C56uL,
+            0x57AF154FuL, 0x9B0515D1uL, 0x158A1232uL, 0xD92012ACuL, 0x7CBB312BuL, 0xB01131B5uL,
+            0x3E9E3656uL, 0xF23436C8uL, 0xF8F13FD1uL, 0x345B3F4FuL, 0xBAD438ACuL, 0x767E3832uL,
+            0xAF5E2A9EuL, 0x63F42A00uL, 0xED7B2DE3uL, 0x21D12D7DuL, 0x2B142464uL, 0xE7BE24FAuL,
+            0x69312319uL, 0xA59B2387uL, 0xF9766256uL, 0x35DC62C8uL, 0xBB53652BuL, 0x77F965B5uL,
+            0x7D3C6CACuL, 0xB1966C32uL, 0x3F196BD1uL, 0xF3B36B4FuL, 0x2A9379E3uL, 0xE639797DuL,
+            0x68B67E9EuL, 0xA41C7E00uL, 0xAED97719uL, 0x62737787uL, 0xECFC7064uL, 0x205670FAuL,
+            0x85CD537DuL, 0x496753E3uL, 0xC7E85400uL, 0x0B42549EuL, 0x01875D87uL, 0xCD2D5D19uL,
+            0x43A25AFAuL, 0x8F085A64uL, 0x562848C8uL, 0x9A824856uL, 0x140D4FB5uL, 0xD8A74F2BuL,
+            0xD2624632uL, 0x1EC846ACuL, 0x9047414FuL, 0x5CED41D1uL, 0x299DC2EDuL, 0xE537C273uL,
+            0x6BB8C590uL, 0xA712C50EuL, 0xADD7CC17uL, 0x617DCC89uL, 0xEFF2CB6AuL, 0x2358CBF4uL,
+            0xFA78D958uL, 0x36D2D9C6uL, 0xB85DDE25uL, 0x74F7DEBBuL, 0x7E32D7A2uL, 0xB298D73CuL,
+            0x3C17D0DFuL, 0xF0BDD041uL, 0x5526F3C6uL, 0x998CF358uL, 0x1703F4BBuL, 0xDBA9F425uL,
+            0xD16CFD3CuL, 0x1DC6FDA2uL, 0x9349FA41uL, 0x5FE3FADFuL, 0x86C3E873uL, 0x4A69E8EDuL,
+            0xC4E6EF0EuL, 0x084CEF90uL, 0x0289E689uL, 0xCE23E617uL, 0x40ACE1F4uL, 0x8C06E16AuL,
+            0xD0EBA0BBuL, 0x1C41A025uL, 0x92CEA7C6uL, 0x5E64A758uL, 0x54A1AE41uL, 0x980BAEDFuL,
+            0x1684A93CuL, 0xDA2EA9A2uL, 0x030EBB0EuL, 0xCFA4BB90uL, 0x412BBC73uL, 0x8D81BCEDuL,
+            0x8744B5F4uL, 0x4BEEB56AuL, 0xC561B289uL, 0x09CBB217uL, 0xAC509190uL, 0x60FA910EuL,
+            0xEE7596EDuL, 0x22DF9673uL, 0x281A9F6AuL, 0xE4B09FF4uL, 0x6A3F9817uL, 0xA6959889uL,
+            0x7FB58A25uL, 0xB31F8ABBuL, 0x3D908D58uL, 0xF13A8DC6uL, 0xFBFF84DFuL, 0x37558441uL,
+            0xB9DA83A2uL, 0x7570833CuL, 0x533B85DAuL, 0x9F918544uL, 0x111E82A7uL, 0xDDB48239uL,
+            0xD7718B20uL, 0x1BDB8BBEuL, 0x95548C5DuL, 0x59FE8CC3uL, 0x80DE9E6FuL, 0x4C749EF1uL,
+            0xC2FB9912uL, 0x0E51998CuL, 0x04949095uL, 0xC83E900BuL, 0x46B197E8uL, 0x8A1B9776uL,
+            0x2F80B4F1uL, 0xE32AB46FuL, 0x6DA5B38CuL, 0xA10FB312uL, 0xABCABA0BuL, 0x6760BA95uL,
+            0xE9EFBD76uL, 0x2545BDE8uL, 0xFC65AF44uL, 0x30CFAFDAuL, 0xBE40A839uL, 0x72EAA8A7uL,
+            0x782FA1BEuL, 0xB485A120uL, 0x3A0AA6C3uL, 0xF6A0A65DuL, 0xAA4DE78CuL, 0x66E7E712uL,
+            0xE868E0F1uL, 0x24C2E06FuL, 0x2E07E976uL, 0xE2ADE9E8uL, 0x6C22EE0BuL, 0xA088EE95uL,
+            0x79A8FC39uL, 0xB502FCA7uL, 0x3B8DFB44uL, 0xF727FBDAuL, 0xFDE2F2C3uL, 0x3148F25DuL,
+            0xBFC7F5BEuL, 0x736DF520uL, 0xD6F6D6A7uL, 0x1A5CD639uL, 0x94D3D1DAuL, 0x5879D144uL,
+            0x52BCD85DuL, 0x9E16D8C3uL, 0x1099DF20uL, 0xDC33DFBEuL, 0x0513CD12uL, 0xC9B9CD8CuL,
+            0x4736CA6FuL, 0x8B9CCAF1uL, 0x8159C3E8uL, 0x4DF3C376uL, 0xC37CC495uL, 0x0FD6C40BuL,
+            0x7AA64737uL, 0xB60C47A9uL, 0x3883404AuL, 0xF42940D4uL, 0xFEEC49CDuL, 0x32464953uL,
+            0xBCC94EB0uL, 0x70634E2EuL, 0xA9435C82uL, 0x65E95C1CuL, 0xEB665BFFuL, 0x27CC5B61uL,
+            0x2D095278uL, 0xE1A352E6uL, 0x6F2C5505uL, 0xA386559BuL, 0x061D761CuL, 0xCAB77682uL,
+            0x44387161uL, 0x889271FFuL, 0x825778E6uL, 0x4EFD7878uL, 0xC0727F9BuL, 0x0CD87F05uL,
+            0xD5F86DA9uL, 0x19526D37uL, 0x97DD6AD4uL, 0x5B776A4AuL, 0x51B26353uL, 0x9D1863CDuL,
+            0x1397642EuL, 0xDF3D64B0uL, 0x83D02561uL, 0x4F7A25FFuL, 0xC1F5221CuL, 0x0D5F2282uL,
+            0x079A2B9BuL, 0xCB302B05uL, 0x45BF2CE6uL, 0x89152C78uL, 0x50353ED4uL, 0x9C9F3E4AuL,
+            0x121039A9uL, 0xDEBA3937uL, 0xD47F302EuL, 0x18D530B0uL, 0x965A3753uL, 0x5AF037CDuL,
+            0xFF6B144AuL, 0x33C114D4uL, 0xBD4E1337uL, 0x71E413A9uL, 0x7B211AB0uL, 0xB78B1A2EuL,
+            0x39041DCDuL, 0xF5AE1D53uL, 0x2C8E0FFFuL, 0xE0240F61uL, 0x6EAB0882uL, 0xA201081CuL,
+            0xA8C40105uL, 0x646E019BuL, 0xEAE10678uL, 0x264B06E6uL
+        }
+    };
+    #endif
+#else
+    /*the bitwise mode does not use tables*/
+#endif
+
+/*============================================================================*/
+/*qUINT8_t qCRC8_Update( qUINT8_t crc, const void *Data, size_t n )
+
+Update a CRC-8 (poly 0x07, init 0x00, not reflected, xorout 0x00) with <n> bytes.
+Can be called incrementally, starting with QCRC8_INIT, as the data arrives. The 
+function only uses its arguments, so it is safe to use it from ISRs.
+
+Parameters:
+
+    - crc : The current CRC value (QCRC8_INIT to start a new one).
+    - Data : A pointer to the data block.
+    - n : The number of bytes of the data block.
+
+Return value:
+
+    The updated CRC value. Check value for "123456789" : 0xF4
+*/
+qUINT8_t qCRC8_Update( qUINT8_t crc, const void *Data, size_t n ){
+    /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+    const qUINT8_t *p = Data; /*MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed*/
+    /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+
+    if( NULL != p ){
+        for( ; n > 0u ; --n ){
+            #if ( Q_CRC_MODE == QCRC_MODE_BITWISE )
+                qUINT8_t bit;
+
+                crc ^= *p;
+                for( bit = 0u ; bit < 8u ; ++bit ){
+                    crc = ( 0u != ( crc & 0x80u ) )? (qUINT8_t)( (qUINT8_t)( crc << 1u ) ^ QCRC8_POLY ) : (qUINT8_t)( crc << 1u );
+                }
+            #elif ( Q_CRC_MODE == QCRC_MODE_NIBBLE )
+                crc = (qUINT8_t)( (qUINT8_t)( crc << 4u ) ^ qCRC8_Table[ ( crc >> 4u ) ^ ( *p >> 4u ) ] );
+                crc = (qUINT8_t)( (qUINT8_t)( crc << 4u ) ^ qCRC8_Table[ ( crc >> 4u ) ^ ( *p & 0x0Fu ) ] );
+            #else
+                crc = qCRC8_Table[ crc ^ *p ];
+            #endif
+            ++p;
+        }
+    }
+    return crc;
+}
+/*============================================================================*/
+/*qUINT16_t qCRC16_Update( qUINT16_t crc, const void *Data, size_t n )
+
+Update a CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF, not reflected, xorout 0x0000)
+with <n> bytes. Can be called incrementally, starting with QCRC16_INIT, as the data
+arrives. The function only uses its arguments, so it is safe to use it from ISRs.
+
+Parameters:
+
+    - crc : The current CRC value (QCRC16_INIT to start a new one).
+    - Data : A pointer to the data block.
+    - n : The number of bytes of the data block.
+
+Return value:
+
+    The updated CRC value. Check value for "123456789" : 0x29B1
+*/
+qUINT16_t qCRC16_Update( qUINT16_t crc, const void *Data, size_t n ){
+    /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+    const qUINT8_t *p = Data; /*MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed*/
+    /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+
+    if( NULL != p ){
+        for( ; n > 0u ; --n ){
+            #if ( Q_CRC_MODE == QCRC_MODE_BITWISE )
+                qUINT8_t bit;
+
+                crc ^= (qUINT16_t)( (qUINT16_t)*p << 8u );
+                for( bit = 0u ; bit < 8u ; ++bit ){
+                    crc = ( 0u != ( crc & 0x8000u ) )? (qUINT16_t)( (qUINT16_t)( crc << 1u ) ^ QCRC16_POLY ) : (qUINT16_t)( crc << 1u );
+                }
+            #elif ( Q_CRC_MODE == QCRC_MODE_NIBBLE )
+                crc = (qUINT16_t)( (qUINT16_t)( crc << 4u ) ^ qCRC16_Table[ ( crc >> 12u ) ^ ( *p >> 4u ) ] );
+                crc = (qUINT16_t)( (qUINT16_t)( crc << 4u ) ^ qCRC16_Table[ ( crc >> 12u ) ^ ( *p & 0x0Fu ) ] );
+            #else
+                crc = (qUINT16_t)( (qUINT16_t)( crc << 8u ) ^ qCRC16_Table[ (qUINT8_t)( crc >> 8u ) ^ *p ] );
+            #endif
+            ++p;
+        }
+    }
+    return crc;
+}
+/*============================================================================*/
+/*qUINT32_t qCRC32_Update( qUINT32_t crc, const void *Data, size_t n )
+
+Update a CRC-32 (IEEE 802.3 : poly 0x04C11DB7, init 0xFFFFFFFF, reflected, 
+xorout 0xFFFFFFFF) with <n> bytes. Can be called incrementally, starting with 
+QCRC32_INIT, as the data arrives. The xorout is not applied here, use 
+qCRC32_Final() to get the CRC value. The function only uses its arguments, so it
+is safe to use it from ISRs.
+
+Parameters:
+
+    - crc : The current CRC register (QCRC32_INIT to start a new one).
+    - Data : A pointer to the data block.
+    - n : The number of bytes of the data block.
+
+Return value:
+
+    The updated CRC register. Check value for "123456789" : 0xCBF43926 (after
+    qCRC32_Final)
+*/
+qUINT32_t qCRC32_Update( qUINT32_t crc, const void *Data, size_t n ){
+    /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+    const qUINT8_t *p = Data; /*MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed*/
+    /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+
+    if( NULL != p ){
+        #if ( QCRC_SLICE_BY_8 == 1 )
+            for( ; n >= 8u ; n -= 8u ){ /*eight bytes per step, the words are assembled bytewise to be endian-neutral*/
+                const qUINT32_t lo = crc ^ ( (qUINT32_t)p[ 0 ] | ( (qUINT32_t)p[ 1 ] << 8u ) | ( (qUINT32_t)p[ 2 ] << 16u ) | ( (qUINT32_t)p[ 3 ] << 24u ) );
+                const qUINT32_t hi = (qUINT32_t)p[ 4 ] | ( (qUINT32_t)p[ 5 ] << 8u ) | ( (qUINT32_t)p[ 6 ] << 16u ) | ( (qUINT32_t)p[ 7 ] << 24u );
+
+                crc = qCRC32_Slice[ 6 ][ lo & 0xFFuL ] ^ qCRC32_Slice[ 5 ][ ( lo >> 8u ) & 0xFFuL ] ^
+                      qCRC32_Slice[ 4 ][ ( lo >> 16u ) & 0xFFuL ] ^ qCRC32_Slice[ 3 ][ lo >> 24u ] ^
+                      qCRC32_Slice[ 2 ][ hi & 0xFFuL ] ^ qCRC32_Slice[ 1 ][ ( hi >> 8u ) & 0xFFuL ] ^
+                      qCRC32_Slice[ 0 ][ ( hi >> 16u ) & 0xFFuL ] ^ qCRC32_Table[ hi >> 24u ];
+                p = &p[ 8 ];
+            }
+        #endif
+        for( ; n > 0u ; --n ){
+            #if ( Q_CRC_MODE == QCRC_MODE_BITWISE )
+                qUINT8_t bit;
+
+                crc ^= (qUINT32_t)*p;
+                for( bit = 0u ; bit < 8u ; ++bit ){
+                    crc = ( 0uL != ( crc & 1uL ) )? ( ( crc >> 1u ) ^ QCRC32_POLY_REFLECTED ) : ( crc >> 1u );
+                }
+            #elif ( Q_CRC_MODE == QCRC_MODE_NIBBLE )
+                crc = ( crc >> 4u ) ^ qCRC32_Table[ ( crc ^ (qUINT32_t)*p ) & 0x0FuL ];
+                crc = ( crc >> 4u ) ^ qCRC32_Table[ ( crc ^ ( (qUINT32_t)*p >> 4u ) ) & 0x0FuL ];
+            #else
+                crc = ( crc >> 8u ) ^ qCRC32_Table[ ( crc ^ (qUINT32_t)*p ) & 0xFFuL ];
+            #endif
+            ++p;
+        }
+    }
+    return crc;
+}
+/*============================================================================*/
+/*qUINT8_t qCRC8( const void *Data, size_t n )
+
+Compute the CRC-8 of a whole data block. See <qCRC8_Update>.
+
+Parameters:
+
+    - Data : A pointer to the data block.
+    - n : The number of bytes of the data block.
+
+Return value:
+
+    The CRC-8 value
+*/
+qUINT8_t qCRC8( const void *Data, size_t n ){
+    return qCRC8_Update( QCRC8_INIT, Data, n );
+}
+/*============================================================================*/
+/*qUINT16_t qCRC16( const void *Data, size_t n )
+
+Compute the CRC-16/CCITT-FALSE of a whole data block. See <qCRC16_Update>.
+
+Parameters:
+
+    - Data : A pointer to the data block.
+    - n : The number of bytes of the data block.
+
+Return value:
+
+    The CRC-16 value
+*/
+qUINT16_t qCRC16( const void *Data, size_t n ){
+    return qCRC16_Update( QCRC16_INIT, Data, n );
+}
+/*============================================================================*/
+/*qUINT32_t qCRC32( const void *Data, size_t n )
+
+Compute the CRC-32 of a whole data block. See <qCRC32_Update>.
+
+Parameters:
+
+    - Data : A pointer to the data block.
+    - n : The number of bytes of the data block.
+
+Return value:
+
+    The CRC-32 value
+*/
+qUINT32_t qCRC32( const void *Data, size_t n ){
+    return qCRC32_Final( qCRC32_Update( QCRC32_INIT, Data, n ) );
+}
+/*============================================================================*/
+
+#endif /* #if ( Q_CRC == 1 ) */
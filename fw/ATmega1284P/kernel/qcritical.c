@@ -3,37 +3,58 @@
 typedef struct{
     qInt_Disabler_t I_Disable;      /*< Point to the user-supplied function used to disable the hardware interrupts. */
     qInt_Restorer_t I_Restorer;     /*< Point to the user-supplied function used to restore the hardware interrupts. */
-    volatile qUINT32_t IntFlags;    /*< To save the current interrupt flags before the disable action is performed. */
+    volatile qUINT32_t IntFlags;    /*< To save the interrupt flags before the outermost disable action is performed. */
+    volatile qUINT32_t NestedFlags; /*< To save the interrupt flags returned by the nested disable actions. */
+    volatile qUINT8_t Nesting;      /*< The current nesting level of the critical section (only accessed inside the section). */
 }qCritical_Handler_t;
 
-static qCritical_Handler_t Critical = { NULL, NULL , 0uL};
+static qCritical_Handler_t Critical = { NULL, NULL , 0uL, 0uL, 0u };
 
 /*============================================================================*/
-/*void qEnterCritical( void )
+/*void qCritical_Enter( void )
 
 Enter a critical section. This function invokes the <Disabler> if available.
+Critical sections can be nested: the <Disabler> is invoked on every call and 
+the flags saved by the outermost call are the ones restored at the end.
 Please see <qCritical_SetInterruptsED>
 
 */  
 void qCritical_Enter( void ){
+    qUINT32_t Flags = 0uL;
+
     if( NULL != Critical.I_Disable ){
         qInt_Disabler_t Disabler = Critical.I_Disable;
 
-        Critical.IntFlags = Disabler();
+        Flags = Disabler(); /*the nesting level is only read once the section is owned*/
+    }
+    if( 0u == Critical.Nesting ){
+        Critical.IntFlags = Flags;
+    }
+    else{
+        Critical.NestedFlags = Flags;
     }
+    ++Critical.Nesting;
 }
 /*============================================================================*/
-/*void qEnterCritical( void )
+/*void qCritical_Exit( void )
 
-Enter a critical section. This function invokes the <Enabler> if available.
+Exit a critical section. This function invokes the <Restorer> if available.
+Every call is paired with the <Disabler> call of the matching 
+<qCritical_Enter>, only the outermost call restores the saved flags.
 Please see <qCritical_SetInterruptsED>
 
 */ 
 void qCritical_Exit( void ){
-    if( NULL != Critical.I_Restorer ){
-        qInt_Restorer_t Restorer = Critical.I_Restorer;
+    if( Critical.Nesting > 0u ){
+        qUINT32_t Flags;
 
-        Restorer( Critical.IntFlags );
+        --Critical.Nesting;
+        Flags = ( 0u == Critical.Nesting )? Critical.IntFlags : Critical.NestedFlags;
+        if( NULL != Critical.I_Restorer ){
+            qInt_Restorer_t Restorer = Critical.I_Restorer;
+
+            Restorer( Flags ); /*the nesting level is updated before the section is released*/
+        }
     }
 }
 /*============================================================================*/
@@ -43,6 +64,11 @@ Set the hardware-specific code for global interrupt enable/disable.
 Setting this allows you to comunicate safely from Interrupts using queued notifications
 or qQueues.
 
+  Note : The <Disabler> is invoked on every <qCritical_Enter>, including the 
+         nested ones, and each call is paired with a <Restorer> call. The pair
+         must therefore tolerate nesting (the interrupt save/restore pair does).
+         A lock used here must be recursive for the owning context.
+
 Parameters:
 
     - Restorer : The function with hardware specific code that enables or 
@@ -0,0 +1,279 @@
+#include "qctimers.h"
+
+#if ( Q_CALLBACK_TIMERS == 1 )
+
+static qList_t ActiveTimers = QLIST_INITIALIZER;   /*< The armed timers, ordered by their expiration time. */
+static qTask_t *ServiceTask = NULL;                 /*< The task that services the expired timers. */
+
+static void qCTimer_Insert( qCTimer_t * const Timer );
+static void qCTimer_ServiceRearm( void );
+static void qCTimer_ServiceCallback( qEvent_t e );
+
+/*============================================================================*/
+static void qCTimer_Insert( qCTimer_t * const Timer ){
+    qList_Node_t *iNode;
+    qList_Position_t xPosition = QLIST_ATBACK;
+    qList_Position_t iPos = QLIST_ATFRONT;
+
+    for( iNode = ActiveTimers.head ; NULL != iNode ; iNode = iNode->next ){
+        const qCTimer_t *iTimer = (const qCTimer_t*)iNode; /*MISRAC2012-Rule-11.3 allowed*/
+        /*stop at the first timer expiring later (equal expirations keep the FIFO order)*/
+        if( (qINT32_t)( Timer->qPrivate.Expiry - iTimer->qPrivate.Expiry ) < 0 ){
+            xPosition = iPos;
+            break;
+        }
+        ++iPos;
+    }
+    (void)qList_Insert( &ActiveTimers, Timer, xPosition );
+}
+/*============================================================================*/
+static void qCTimer_ServiceRearm( void ){
+    if( NULL != ServiceTask ){
+        const qCTimer_t *Head = (const qCTimer_t*)ActiveTimers.head; /*MISRAC2012-Rule-11.3 allowed*/
+
+        if( NULL != Head ){
+            qClock_t Remaining = Head->qPrivate.Expiry - qClock_GetTick();
+
+            if( (qINT32_t)Remaining <= 0 ){
+                Remaining = 1uL; /*already expired : make the service ready on the next scheduling cycle*/
+            }
+            qTask_Set_State( ServiceTask, qEnabled );
+            /*the service task wakes up exactly at the earliest expiration*/
+            ServiceTask->qPrivate.timer.TV = Remaining;
+            ServiceTask->qPrivate.timer.Start = Head->qPrivate.Expiry - Remaining;
+        }
+        else{
+            qTask_Set_State( ServiceTask, qDisabled ); /*nothing to wait for*/
+        }
+    }
+}
+/*============================================================================*/
+static void qCTimer_ServiceCallback( qEvent_t e ){
+    qCTimer_t *Head;
+    qClock_t Now = qClock_GetTick();
+    (void)e;
+
+    qCritical_Enter();
+    Head = (qCTimer_t*)ActiveTimers.head; /*MISRAC2012-Rule-11.3 allowed*/
+    while( ( NULL != Head ) && ( (qINT32_t)( Now - Head->qPrivate.Expiry ) >= 0 ) ){
+        qCTimerFcn_t Callback = Head->qPrivate.Callback;
+
+        (void)qList_Remove( &ActiveTimers, NULL, QLIST_ATFRONT );
+        if( Head->qPrivate.Period > 0uL ){
+            qClock_t Lost = ( Now - Head->qPrivate.Expiry )/Head->qPrivate.Period;
+            /*reload from the nominal expiration, lost periods are skipped*/
+            Head->qPrivate.Expiry += Head->qPrivate.Period*( Lost + 1uL );
+            qCTimer_Insert( Head );
+        }
+        qCritical_Exit();
+        if( NULL != Callback ){ /*the callback is free to stop or restart any timer*/
+            Callback( Head );
+        }
+        qCritical_Enter();
+        Head = (qCTimer_t*)ActiveTimers.head; /*MISRAC2012-Rule-11.3 allowed*/
+    }
+    qCTimer_ServiceRearm();
+    qCritical_Exit();
+}
+/*============================================================================*/
+/*qBool_t qCTimer_Service_Setup( qTask_t * const Task, const qPriority_t Priority )
+
+Add the task that services the callback timers to the scheduling scheme. The
+armed timers are kept in a single list ordered by expiration time, so the kernel
+only checks the earliest one: the service task gets rearmed to that expiration
+and stays disabled while no timer is armed. The timer callbacks are invoked
+from this task context.
+
+Parameters:
+
+    - Task : A pointer to the task node.
+    - Priority : Task priority Value. [0(min) - Q_PRIORITY_LEVELS(max)]
+
+Return value:
+
+    Returns qTrue on success, otherwise returns qFalse;
+*/
+qBool_t qCTimer_Service_Setup( qTask_t * const Task, const qPriority_t Priority ){
+    qBool_t RetValue;
+
+    RetValue = qOS_Add_Task( Task, qCTimer_ServiceCallback, Priority, qTimeImmediate, qPeriodic, qDisabled, NULL );
+    if( qTrue == RetValue ){
+        qCritical_Enter();
+        ServiceTask = Task;
+        qCTimer_ServiceRearm();
+        qCritical_Exit();
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qCTimer_Setup( qCTimer_t * const Timer, const qCTimerFcn_t Callback, void *Data )
+
+Initialize a callback timer. The timer remains stopped until <qCTimer_Start>
+is called.
+
+Parameters:
+
+    - Timer : A pointer to the callback timer object.
+    - Callback : The function invoked from the service task when the timer
+                 expires. Prototype: void xCallback( qCTimer_t * const Timer )
+    - Data : The timer storage pointer. Can be retrieved from the callback
+             using <qCTimer_Get_Data>.
+
+Return value:
+
+    Returns qTrue on success, otherwise returns qFalse;
+*/
+qBool_t qCTimer_Setup( qCTimer_t * const Timer, const qCTimerFcn_t Callback, void *Data ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Timer ){
+        Timer->qPrivate.next = NULL;
+        Timer->qPrivate.prev = NULL;
+        Timer->qPrivate.container = NULL;
+        Timer->qPrivate.Callback = Callback;
+        Timer->qPrivate.Data = Data;
+        Timer->qPrivate.Expiry = 0uL;
+        Timer->qPrivate.Period = 0uL;
+        RetValue = qTrue;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qCTimer_Start( qCTimer_t * const Timer, const qTime_t Time, const qCTimer_Mode_t Mode )
+
+Start (or restart) a callback timer. If the timer is already running, it gets
+re-armed with the new time.
+
+Parameters:
+
+    - Timer : A pointer to the callback timer object.
+    - Time : The expiration time in seconds. Build it with <qTime_Seconds>
+             (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is enabled).
+    - Mode : qCTimer_OneShot or qCTimer_AutoReload. Auto-reload timers are
+             re-armed from their nominal expiration, so they do not drift.
+
+    > Note : The OS must be running before using callback timers.
+
+Return value:
+
+    Returns qTrue on success, otherwise returns qFalse;
+*/
+qBool_t qCTimer_Start( qCTimer_t * const Timer, const qTime_t Time, const qCTimer_Mode_t Mode ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Timer ){
+        qClock_t Epochs = qClock_Convert2Clock( Time );
+
+        if( ( qCTimer_OneShot == Mode ) || ( Epochs > 0uL ) ){ /*auto-reload timers require a non-zero period*/
+            qCritical_Enter();
+            if( &ActiveTimers == Timer->qPrivate.container ){
+                (void)qList_RemoveItself( Timer );
+            }
+            Timer->qPrivate.Period = ( qCTimer_AutoReload == Mode )? Epochs : 0uL;
+            Timer->qPrivate.Expiry = qClock_GetTick() + Epochs;
+            qCTimer_Insert( Timer );
+            qCTimer_ServiceRearm();
+            qCritical_Exit();
+            RetValue = qTrue;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qCTimer_Stop( qCTimer_t * const Timer )
+
+Stop a callback timer. The callback will not be invoked until the timer
+gets started again.
+
+Parameters:
+
+    - Timer : A pointer to the callback timer object.
+
+Return value:
+
+    Returns qTrue if the timer was running, otherwise returns qFalse;
+*/
+qBool_t qCTimer_Stop( qCTimer_t * const Timer ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Timer ){
+        qCritical_Enter();
+        if( &ActiveTimers == Timer->qPrivate.container ){
+            (void)qList_RemoveItself( Timer );
+            qCTimer_ServiceRearm();
+            RetValue = qTrue;
+        }
+        qCritical_Exit();
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qCTimer_IsActive( const qCTimer_t * const Timer )
+
+Query if the callback timer is running.
+
+Parameters:
+
+    - Timer : A pointer to the callback timer object.
+
+Return value:
+
+    qTrue when running, otherwise qFalse.
+*/
+qBool_t qCTimer_IsActive( const qCTimer_t * const Timer ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Timer ){
+        RetValue = ( &ActiveTimers == Timer->qPrivate.container )? qTrue : qFalse;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qClock_t qCTimer_Remaining( const qCTimer_t * const Timer )
+
+Query the remaining epochs until the next expiration of the callback timer.
+
+Parameters:
+
+    - Timer : A pointer to the callback timer object.
+
+Return value:
+
+    The remaining time specified in epochs. 0 if the expiration is pending to
+    be serviced. QCTIMER_REMAINING_IN_STOPPED_STATE if the timer is stopped.
+*/
+qClock_t qCTimer_Remaining( const qCTimer_t * const Timer ){
+    qClock_t RetValue = QCTIMER_REMAINING_IN_STOPPED_STATE;
+
+    if( qTrue == qCTimer_IsActive( Timer ) ){
+        RetValue = Timer->qPrivate.Expiry - qClock_GetTick();
+        if( (qINT32_t)RetValue < 0 ){
+            RetValue = 0uL;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*void* qCTimer_Get_Data( const qCTimer_t * const Timer )
+
+Get the storage pointer of the callback timer.
+
+Parameters:
+
+    - Timer : A pointer to the callback timer object.
+
+Return value:
+
+    The storage pointer specified in <qCTimer_Setup>.
+*/
+void* qCTimer_Get_Data( const qCTimer_t * const Timer ){
+    void *RetValue = NULL;
+
+    if( NULL != Timer ){
+        RetValue = Timer->qPrivate.Data;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+
+#endif /* #if ( Q_CALLBACK_TIMERS == 1 ) */
@@ -2,6 +2,8 @@
 
 #if ( Q_EDGE_CHECK_IOGROUPS == 1 )
 
+static void qEdgeCheck_PortSweep( qEdgeCheck_t * const Instance );
+
 /*============================================================================*/
 /*qBool_t qEdgeCheck_Setup( qEdgeCheck_t * const Instance, const qCoreRegSize_t RegisterSize, const qClock_t DebounceTime )
  
@@ -22,10 +24,25 @@ qBool_t qEdgeCheck_Setup( qEdgeCheck_t * const Instance, const qCoreRegSize_t Re
 
     if( NULL != Instance ){
         Instance->qPrivate.Head = NULL;
+        Instance->qPrivate.PortHead = NULL;
+        Instance->qPrivate.Task = NULL;
+        #if ( Q_QUEUES == 1 )
+            Instance->qPrivate.Queue = NULL;
+        #endif
         Instance->qPrivate.DebounceTime = DebounceTime;
         Instance->qPrivate.Reader = ( NULL == RegisterSize )? &QREG_32BIT  : RegisterSize;
+        if( &QREG_8BIT == Instance->qPrivate.Reader ){
+            Instance->qPrivate.PortReader = &_qPort_08Bits;
+        }
+        else if( &QREG_16BIT == Instance->qPrivate.Reader ){
+            Instance->qPrivate.PortReader = &_qPort_16Bits;
+        }
+        else{
+            Instance->qPrivate.PortReader = &_qPort_32Bits;
+        }
         Instance->qPrivate.State = QEDGECHECK_CHECK;
         Instance->qPrivate.Start = qClock_GetTick();
+        Instance->qPrivate.PortStart = Instance->qPrivate.Start;
         RetValue = qTrue;
     }
     return RetValue;
@@ -62,6 +79,93 @@ qBool_t qEdgeCheck_Add_Node( qEdgeCheck_t * const Instance, qEdgeCheck_IONode_t
     return RetValue;
 }
 /*============================================================================*/
+/*qBool_t qEdgeCheck_Add_PortNode( qEdgeCheck_t * const Instance, qEdgeCheck_PortNode_t * const Node, const void *PortAddress, const qUINT32_t PinMask )
+
+Add a whole port to the I/O Edge-Check instance. All the pins selected by
+<PinMask> are sampled with a single register read per sweep and the edges are
+obtained for the entire port at once with bitwise operations, instead of one
+reader call per pin. Use this node kind when several inputs share the same
+port register.
+Port pins are debounced individually: the port is sampled every
+DebounceTime/QEDGECHECK_PORT_SAMPLES and a pin level is accepted after
+QEDGECHECK_PORT_SAMPLES consecutive samples, so a noisy pin never delays the
+edges on the other pins (or on the other nodes of the instance).
+
+Parameters:
+
+    - Instance : A pointer to the I/O Edge-Check object
+    - Node: A pointer to the Port-Node object
+    - PortAddress : The address of the core PORTx-register to read
+    - PinMask : The pins of the port to check (bit n selects the pin n)
+
+Return value:
+
+    qTrue on success, otherwise returns qFalse
+*/
+qBool_t qEdgeCheck_Add_PortNode( qEdgeCheck_t * const Instance, qEdgeCheck_PortNode_t * const Node, const void *PortAddress, const qUINT32_t PinMask ){
+    qBool_t RetValue = qFalse;
+
+    if( ( NULL != Node ) && ( NULL != Instance ) && ( NULL != PortAddress ) ){
+        qCorePortReader_t PortReader = Instance->qPrivate.PortReader;
+
+        Node->qPrivate.Port = PortAddress;
+        Node->qPrivate.Mask = PinMask;
+        Node->qPrivate.Levels = PortReader( PortAddress ) & PinMask;
+        Node->qPrivate.Unknown = 0uL;
+        Node->qPrivate.Count0 = 0xFFFFFFFFuL;
+        Node->qPrivate.Count1 = 0xFFFFFFFFuL;
+        Node->qPrivate.Rising = 0uL;
+        Node->qPrivate.Falling = 0uL;
+        Node->qPrivate.Next = Instance->qPrivate.PortHead;
+        Instance->qPrivate.PortHead = Node;
+        RetValue = qTrue;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+static void qEdgeCheck_PortSweep( qEdgeCheck_t * const Instance ){
+    qClock_t Now = qClock_GetTick();
+
+    if( ( Now - Instance->qPrivate.PortStart ) >= ( Instance->qPrivate.DebounceTime/(qClock_t)QEDGECHECK_PORT_SAMPLES ) ){
+        qEdgeCheck_PortNode_t *Node;
+        qCorePortReader_t PortReader = Instance->qPrivate.PortReader;
+        qBool_t Notify = qFalse;
+
+        Instance->qPrivate.PortStart = Now;
+        for( Node = Instance->qPrivate.PortHead ; NULL != Node ; Node = Node->qPrivate.Next ){ /*iterate through all the port-nodes*/
+            qUINT32_t Current = PortReader( Node->qPrivate.Port ) & Node->qPrivate.Mask; /*read the whole port once*/
+            qUINT32_t Changed = Current ^ Node->qPrivate.Levels;
+            qUINT32_t Toggled;
+
+            /*2-bit vertical counter : every changed pin counts down, a stable pin reloads its counter*/
+            Node->qPrivate.Count0 = ~( Node->qPrivate.Count0 & Changed );
+            Node->qPrivate.Count1 = Node->qPrivate.Count0 ^ ( Node->qPrivate.Count1 & Changed );
+            Toggled = Changed & Node->qPrivate.Count0 & Node->qPrivate.Count1; /*counter expired*/
+            Node->qPrivate.Levels ^= Toggled;
+            Node->qPrivate.Rising = Toggled & Node->qPrivate.Levels;
+            Node->qPrivate.Falling = Toggled & ~Node->qPrivate.Levels;
+            Node->qPrivate.Unknown = Changed & ~Toggled;
+            if( 0uL != Toggled ){
+                #if ( Q_QUEUES == 1 )
+                    if( NULL != Instance->qPrivate.Queue ){
+                        qEdgeCheck_Event_t Event;
+
+                        Event.Node = Node;
+                        Event.Rising = Node->qPrivate.Rising;
+                        Event.Falling = Node->qPrivate.Falling;
+                        Event.Timestamp = Now;
+                        (void)qQueue_SendToBack( Instance->qPrivate.Queue, &Event );
+                    }
+                #endif
+                Notify = qTrue;
+            }
+        }
+        if( qTrue == Notify ){ /*a single notification per sweep*/
+            (void)qTask_Notification_Send( Instance->qPrivate.Task, Instance );
+        }
+    }
+}
+/*============================================================================*/
 /*qBool_t qEdgeCheck_Update( qEdgeCheck_t * const Instance )
  
 Update the status of all nodes inside the I/O Edge-Check instance (Non-Blocking call).
@@ -79,6 +183,7 @@ qBool_t qEdgeCheck_Update( qEdgeCheck_t * const Instance ){
     qBool_t RetValue = qFalse;   
 
     if( NULL != Instance ){ 
+        qEdgeCheck_PortSweep( Instance ); /*the port-nodes have their own per-pin debounce*/
         if( QEDGECHECK_WAIT == Instance->qPrivate.State ){ /*de-bounce wait state*/
             if( ( qClock_GetTick() - Instance->qPrivate.Start ) >= Instance->qPrivate.DebounceTime ){
                 Instance->qPrivate.State = QEDGECHECK_UPDATE; /*debounce time reached, update the inputlevel*/ 
@@ -125,6 +230,60 @@ qBool_t qEdgeCheck_Update( qEdgeCheck_t * const Instance ){
     return RetValue;
 }
 /*============================================================================*/
+/*qBool_t qEdgeCheck_Set_EventTask( qEdgeCheck_t * const Instance, qTask_t * const Task )
+
+Set the task to be notified when edges are detected on the port-nodes. The task
+gets a single simple notification per sweep (no matter how many pins changed)
+and the instance pointer is passed through the <EventData> field.
+
+Parameters:
+
+    - Instance : A pointer to the I/O Edge-Check object
+    - Task : A pointer to the task node. Pass NULL to disable the notification.
+
+Return value:
+
+    qTrue on success, otherwise returns qFalse
+*/
+qBool_t qEdgeCheck_Set_EventTask( qEdgeCheck_t * const Instance, qTask_t * const Task ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Instance ){
+        Instance->qPrivate.Task = Task;
+        RetValue = qTrue;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+#if ( Q_QUEUES == 1 )
+/*qBool_t qEdgeCheck_Set_EventQueue( qEdgeCheck_t * const Instance, qQueue_t * const Queue )
+
+Set a queue to receive the edges detected on the port-nodes. A record of type
+qEdgeCheck_Event_t is sent for every port with at least one accepted edge, so
+the consumers don't need to poll every node. If the queue is full, the record
+is lost.
+
+Parameters:
+
+    - Instance : A pointer to the I/O Edge-Check object
+    - Queue : A pointer to the queue object. The queue must be created with
+              items of size sizeof(qEdgeCheck_Event_t). Pass NULL to disable.
+
+Return value:
+
+    qTrue on success, otherwise returns qFalse
+*/
+qBool_t qEdgeCheck_Set_EventQueue( qEdgeCheck_t * const Instance, qQueue_t * const Queue ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Instance ){
+        Instance->qPrivate.Queue = Queue;
+        RetValue = qTrue;
+    }
+    return RetValue;
+}
+#endif /* #if ( Q_QUEUES == 1 ) */
+/*============================================================================*/
 /*qBool_t qEdgeCheck_GetNodeStatus( const qEdgeCheck_IONode_t * const Node ) 
  
 Query the status of the specified input-node.
@@ -152,6 +311,105 @@ void qEdgeCheck_Set_NodePin( qEdgeCheck_IONode_t * const Node, const qBool_t Pin
     }
 }
 /*============================================================================*/
+/*qUINT32_t qEdgeCheck_Get_PortLevels( const qEdgeCheck_PortNode_t * const Node )
+
+Query the debounced levels of the pins inside the specified port-node.
+
+Parameters:
+
+    - Node : A pointer to the Port-Node object
+
+Return value:
+
+    The levels of the masked pins (bit n holds the level of the pin n)
+*/
+qUINT32_t qEdgeCheck_Get_PortLevels( const qEdgeCheck_PortNode_t * const Node ){
+    qUINT32_t RetValue = 0uL;
+
+    if( NULL != Node ){
+        RetValue = Node->qPrivate.Levels;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qUINT32_t qEdgeCheck_Get_PortRising( const qEdgeCheck_PortNode_t * const Node )
+
+Query the pins of the port-node with a rising edge on the last update.
+
+Parameters:
+
+    - Node : A pointer to the Port-Node object
+
+Return value:
+
+    The rising-edge mask (bit n is set if the pin n had a rising edge)
+*/
+qUINT32_t qEdgeCheck_Get_PortRising( const qEdgeCheck_PortNode_t * const Node ){
+    qUINT32_t RetValue = 0uL;
+
+    if( NULL != Node ){
+        RetValue = Node->qPrivate.Rising;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qUINT32_t qEdgeCheck_Get_PortFalling( const qEdgeCheck_PortNode_t * const Node )
+
+Query the pins of the port-node with a falling edge on the last update.
+
+Parameters:
+
+    - Node : A pointer to the Port-Node object
+
+Return value:
+
+    The falling-edge mask (bit n is set if the pin n had a falling edge)
+*/
+qUINT32_t qEdgeCheck_Get_PortFalling( const qEdgeCheck_PortNode_t * const Node ){
+    qUINT32_t RetValue = 0uL;
+
+    if( NULL != Node ){
+        RetValue = Node->qPrivate.Falling;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qEdgeCheck_Get_PortPinStatus( const qEdgeCheck_PortNode_t * const Node, const qBool_t PinNumber )
+
+Query the status of a single pin inside the specified port-node, with the same
+semantics of <qEdgeCheck_Get_NodeStatus>.
+
+Parameters:
+
+    - Node : A pointer to the Port-Node object
+    - PinNumber : The pin to query
+
+Return value:
+
+    The status of the pin : qTrue, qFalse, qRising, qFalling or qUnknown
+*/
+qBool_t qEdgeCheck_Get_PortPinStatus( const qEdgeCheck_PortNode_t * const Node, const qBool_t PinNumber ){
+    qBool_t RetValue = (qBool_t)qUnknown;
+
+    if( ( NULL != Node ) && ( PinNumber < 32u ) ){
+        qUINT32_t Bit = (qUINT32_t)1uL << PinNumber;
+
+        if( 0uL != ( Node->qPrivate.Unknown & Bit ) ){
+            RetValue = (qBool_t)qUnknown;
+        }
+        else if( 0uL != ( Node->qPrivate.Rising & Bit ) ){
+            RetValue = qRISING;
+        }
+        else if( 0uL != ( Node->qPrivate.Falling & Bit ) ){
+            RetValue = qFALLING;
+        }
+        else{
+            RetValue = ( 0uL != ( Node->qPrivate.Levels & Bit ) )? qTrue : qFalse;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
 /*                        PRIVATE METHODS, DONT USE THEM                      */
 /*============================================================================*/
 /*cstat -CERT-INT34-C_a -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
@@ -176,6 +434,15 @@ qBool_t _qReg_08Bits( const void *Address, qBool_t PinNumber ){
     Register = *((const qUINT8_t*)Address);
     return ( (qUINT8_t)0 != (Register & Mask) );
 }
+qUINT32_t _qPort_32Bits( const void *Address ){
+    return *((const qUINT32_t*)Address);
+}
+qUINT32_t _qPort_16Bits( const void *Address ){
+    return (qUINT32_t)*((const qUINT16_t*)Address);
+}
+qUINT32_t _qPort_08Bits( const void *Address ){
+    return (qUINT32_t)*((const qUINT8_t*)Address);
+}
 /*cstat +CERT-INT34-C_a +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
 /*============================================================================*/
 
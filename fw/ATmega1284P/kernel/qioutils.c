@@ -1,7 +1,114 @@
 #include "qioutils.h"
-
-
+#include <float.h>
+
+typedef struct{
+    qPutString_t fcn;   /*< The output function used to flush the buffer. */
+    void *pStorage;     /*< The storage pointer passed to <fcn>. */
+    char *buffer;       /*< The caller buffer used to collect the output. */
+    size_t size;        /*< The size of the caller buffer. */
+    size_t count;       /*< The number of characters pending to be flushed. */
+    size_t total;       /*< The number of characters written so far. */
+}qIOUtil_PrintfHandler_t;
+
+/*word-at-a-time (SWAR) string scanning is used where the native word is at 
+least 32 bits wide, and only by qIOUtil_BufStrLen and qIOUtil_BufStrChr. Their 
+<size> is the size of the scanned object, and only the aligned words that lie 
+entirely inside it are loaded as a whole, so no byte past the object is read*/
+#if ( Q_IOUTIL_SWAR == 1 ) && defined( SIZE_MAX )
+    #if ( SIZE_MAX >= 0xFFFFFFFFu )
+        #define QIOUTIL_SWAR    ( 1 )
+    #endif
+#endif
+#ifndef QIOUTIL_SWAR
+    #define QIOUTIL_SWAR        ( 0 )
+#endif
+
+#if ( QIOUTIL_SWAR == 1 )
+    typedef size_t qIOUtil_Word_t;
+    #define QIOUTIL_WORD_SIZE                   ( sizeof(qIOUtil_Word_t) )
+    #define QIOUTIL_WORD_ONES                   ( (qIOUtil_Word_t)( ~(qIOUtil_Word_t)0u )/(qIOUtil_Word_t)0xFFu )
+    #define QIOUTIL_WORD_HIGHS                  ( QIOUTIL_WORD_ONES*(qIOUtil_Word_t)0x80u )
+    #define QIOUTIL_WORD_PATTERN( _c_ )         ( QIOUTIL_WORD_ONES*(qIOUtil_Word_t)( (qUINT8_t)(_c_) ) )
+    #define QIOUTIL_WORD_HASZERO( _w_ )         ( ( (_w_) - QIOUTIL_WORD_ONES ) & ( ~(_w_) ) & QIOUTIL_WORD_HIGHS )
+    static size_t qIOUtil_WordSkip( const char *s, const size_t maxlen, const qIOUtil_Word_t Pattern );
+#else
+    #define QIOUTIL_WORD_PATTERN( _c_ )         ( 0u )
+    #define qIOUtil_WordSkip( _s_, _n_, _p_ )   ( (size_t)0u ) /*byte-wise scanning on 8/16-bit targets*/
+#endif
+
+static size_t qIOUtil_StrScan( const char *s, const char ch, const size_t maxlen, const qBool_t Whole );
 static size_t qIOUtil_xBase_U32toA( qUINT32_t num, char* str, qUINT8_t base );
+static void qIOUtil_PrintfFlush( qIOUtil_PrintfHandler_t * const h );
+static void qIOUtil_PrintfPut( qIOUtil_PrintfHandler_t * const h, const char *s, size_t n );
+static void qIOUtil_PrintfPad( qIOUtil_PrintfHandler_t * const h, const char c, size_t n );
+
+static qFloat64_t qIOUtil_Pow10Scale( qFloat64_t x, int exp10 );
+
+/*the 24-bit float mantissa times 10^12 still fits in 64 bits*/
+#define QIOUTIL_FTOA_MAX_SCALE  ( 12u )
+static const qUINT64_t qIOUtil_FtoAPow10[ QIOUTIL_FTOA_MAX_SCALE + 1u ] = { 1uLL, 10uLL, 100uLL, 1000uLL, 10000uLL, 100000uLL, 1000000uLL, 10000000uLL, 
+                                                                          100000000uLL, 1000000000uLL, 10000000000uLL, 100000000000uLL, 1000000000000uLL };
+
+/*the exact powers of ten are bounded by the native double precision. The slow
+path keeps enough significant digits to decide any halfway case and works on a
+bounded big integer sized for the worst exponent of the native double*/
+#if ( DBL_MANT_DIG >= 53 )
+    typedef qUINT64_t qIOUtil_Mantissa_t;
+    typedef qUINT32_t qIOUtil_Limb_t;
+    typedef qUINT64_t qIOUtil_Limb2_t;
+    #define QIOUTIL_ATOF_MAX_DIGITS         ( 19 )
+    #define QIOUTIL_POW10_EXACT             ( 22 )
+    #define QIOUTIL_ATOF_MAX_SCALE          ( 700u )
+    #define QIOUTIL_ATOF_MAX_EXP            ( 9999 )
+    #define QIOUTIL_ATOF_BIG_DIGITS         ( 800 )     /*a binary64 halfway point has at most 767 significant digits*/
+    #define QIOUTIL_ATOF_MIN_10             ( -324 )    /*below 10^-324 the value rounds to zero*/
+    #define QIOUTIL_BIG_LIMBS               ( 92u )
+    #define QIOUTIL_BIG_LIMB_BITS           ( 32u )
+    #define QIOUTIL_BIG_POW5_STEP           ( 13u )     /*5^13 is the largest power of five in a limb*/
+    #define QIOUTIL_BIG_DEC_STEP            ( 9u )      /*10^9 is the largest power of ten in a limb*/
+    static const qFloat64_t qIOUtil_Pow10[ QIOUTIL_POW10_EXACT + 1 ] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+#else /*double is a 32-bit float on targets like AVR*/
+    typedef qUINT32_t qIOUtil_Mantissa_t;
+    typedef qUINT16_t qIOUtil_Limb_t;
+    typedef qUINT32_t qIOUtil_Limb2_t;
+    #define QIOUTIL_ATOF_MAX_DIGITS         ( 9 )
+    #define QIOUTIL_POW10_EXACT             ( 10 )
+    #define QIOUTIL_ATOF_MAX_SCALE          ( 90u )
+    #define QIOUTIL_ATOF_MAX_EXP            ( 999 )
+    #define QIOUTIL_ATOF_BIG_DIGITS         ( 120 )     /*a binary32 halfway point has at most 112 significant digits*/
+    #define QIOUTIL_ATOF_MIN_10             ( -46 )     /*below 10^-46 the value rounds to zero*/
+    #define QIOUTIL_BIG_LIMBS               ( 36u )
+    #define QIOUTIL_BIG_LIMB_BITS           ( 16u )
+    #define QIOUTIL_BIG_POW5_STEP           ( 6u )      /*5^6 is the largest power of five in a limb*/
+    #define QIOUTIL_BIG_DEC_STEP            ( 4u )      /*10^4 is the largest power of ten in a limb*/
+    static const qFloat64_t qIOUtil_Pow10[ QIOUTIL_POW10_EXACT + 1 ] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10
+    };
+#endif
+#define QIOUTIL_ATOF_EXACT_MANTISSA         ( (qIOUtil_Mantissa_t)1u << DBL_MANT_DIG )
+#define QIOUTIL_ATOF_KMIN                   ( DBL_MIN_EXP - DBL_MANT_DIG ) /*binary exponent of the smallest subnormal*/
+#define QIOUTIL_ATOF_KMAX                   ( DBL_MAX_EXP - DBL_MANT_DIG ) /*binary exponent of the largest finite value*/
+
+typedef struct{
+    qIOUtil_Limb_t d[ QIOUTIL_BIG_LIMBS ];  /*< The limbs, least significant first. */
+    size_t n;                               /*< The number of used limbs ( 0 means zero ). */
+}qIOUtil_Big_t;
+
+static void qIOUtil_BigSet( qIOUtil_Big_t * const b, qIOUtil_Mantissa_t v );
+static void qIOUtil_BigMulAdd( qIOUtil_Big_t * const b, const qIOUtil_Limb_t m, qIOUtil_Limb_t a );
+static void qIOUtil_BigMulPow5( qIOUtil_Big_t * const b, unsigned int n );
+static void qIOUtil_BigShiftLeft( qIOUtil_Big_t * const b, unsigned int bits );
+static qIOUtil_Limb_t qIOUtil_BigDivSmall( qIOUtil_Big_t * const b, const qIOUtil_Limb_t d );
+static int qIOUtil_BigCompareScaled( const qIOUtil_Big_t * const D, const int e10, const qIOUtil_Mantissa_t N, const int e2 );
+static qFloat64_t qIOUtil_AtoFSlow( const char *s, const int expPart, const qFloat64_t approx );
+
+static const char qIOUtil_Digits[ 37 ] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+static const char qIOUtil_DigitPairs[ 201 ] = /*"00".."99" : two decimal digits per division*/
+    "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+    "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
 static char qIOUtil_NibbleToX( qUINT8_t value );
 static const char * qIOUtil_DiscardWhitespaces( const char *s, size_t maxlen );
 static const char * qIOUtil_CheckStrSign( const char *s, int *sgn );
@@ -30,6 +137,50 @@ static const char * qIOUtil_CheckStrSign( const char *s, int *sgn ){
     return s;
 }
 /*============================================================================*/
+#if ( QIOUTIL_SWAR == 1 )
+/*returns the number of bytes of <s> that can be skipped in whole aligned words 
+holding neither a null byte nor the <Pattern> byte. Only the words that fit in 
+the first <maxlen> bytes are loaded*/
+static size_t qIOUtil_WordSkip( const char *s, const size_t maxlen, const qIOUtil_Word_t Pattern ){
+    size_t n = 0u;
+    /*cstat -MISRAC2012-Rule-11.4 -CERT-INT36-C*/
+    if( 0u == ( (size_t)s & ( QIOUTIL_WORD_SIZE - 1u ) ) ){ /*MISRAC2012-Rule-11.4,CERT-INT36-C deviation allowed*/
+    /*cstat +MISRAC2012-Rule-11.4 +CERT-INT36-C*/
+        while( ( maxlen - n ) >= QIOUTIL_WORD_SIZE ){
+            qIOUtil_Word_t w;
+
+            (void)memcpy( &w, &s[ n ], QIOUTIL_WORD_SIZE ); /*aligned : compiled as a single load*/
+            if( 0u != ( QIOUTIL_WORD_HASZERO( w ) | QIOUTIL_WORD_HASZERO( w ^ Pattern ) ) ){
+                break;
+            }
+            n += QIOUTIL_WORD_SIZE;
+        }
+    }
+    return n;
+}
+#endif
+/*============================================================================*/
+/*returns the index of the first <ch> or null byte in the first <maxlen> bytes of
+<s>, or <maxlen> if there is none. <Whole> allows the aligned word loads, so it 
+must be set only if the <maxlen> bytes are the scanned object itself*/
+static size_t qIOUtil_StrScan( const char *s, const char ch, const size_t maxlen, const qBool_t Whole ){
+    size_t i = 0u;
+
+    if( qTrue == Whole ){
+        i = qIOUtil_WordSkip( s, maxlen, QIOUTIL_WORD_PATTERN( ch ) );
+        while( ( i < maxlen ) && ( ch != s[ i ] ) && ( '\0' != s[ i ] ) ){
+            ++i;
+            i += qIOUtil_WordSkip( &s[ i ], maxlen - i, QIOUTIL_WORD_PATTERN( ch ) );
+        }
+    }
+    else{
+        while( ( i < maxlen ) && ( ch != s[ i ] ) && ( '\0' != s[ i ] ) ){
+            ++i;
+        }
+    }
+    return i;
+}
+/*============================================================================*/
 /*
 Returns a pointer to the first occurrence of character in the C string str.
 
@@ -50,15 +201,48 @@ Return value:
 */
 char* qIOUtil_StrChr( const char *s, int c, size_t maxlen ){
     char *RetValue = NULL;
-    do{
-        if( (int)(*s) == c ){
+
+    if( NULL != s ){
+        const size_t i = qIOUtil_StrScan( s, (char)c, maxlen, qFalse );
+
+        if( ( i < maxlen ) && ( (char)c == s[ i ] ) ){
             /*cstat -MISRAC2012-Rule-11.8*/
-            RetValue = (char*)s; /*MISRAC2012-Rule-11.8 deviation allowed*/
+            RetValue = (char*)&s[ i ]; /*MISRAC2012-Rule-11.8 deviation allowed*/
             /*cstat +MISRAC2012-Rule-11.8*/
-            break;
         }
-        --maxlen;
-    }while( ( '\0' != ( *s++ ) ) && ( maxlen > 0u ) );
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*char* qIOUtil_BufStrChr( const char *buf, int c, size_t size )
+
+Same as qIOUtil_StrChr, for a string stored in a buffer of <size> bytes. Every
+byte of the buffer must be readable : on 32/64-bit cores the buffer is scanned 
+in whole aligned words.
+
+Parameters:
+
+    - buf : pointer to the buffer holding the string
+    - c : Character to be located. 
+    - size : The size of the buffer in bytes
+
+Return value:
+
+    A pointer to the first occurrence of character in <buf>.
+    If the character is not found, the function returns a null pointer.
+*/
+char* qIOUtil_BufStrChr( const char *buf, int c, size_t size ){
+    char *RetValue = NULL;
+
+    if( NULL != buf ){
+        const size_t i = qIOUtil_StrScan( buf, (char)c, size, qTrue );
+
+        if( ( i < size ) && ( (char)c == buf[ i ] ) ){
+            /*cstat -MISRAC2012-Rule-11.8*/
+            RetValue = (char*)&buf[ i ]; /*MISRAC2012-Rule-11.8 deviation allowed*/
+            /*cstat +MISRAC2012-Rule-11.8*/
+        }
+    }
     return RetValue;
 }
 /*============================================================================*/
@@ -81,20 +265,27 @@ Return value:
   is a null pointer, <maxlen> if the null character was not found.
 */
 size_t qIOUtil_StrLen( const char* str, size_t maxlen ){
-    size_t count;
+    return ( NULL != str )? qIOUtil_StrScan( str, '\0', maxlen, qFalse ) : 0u;
+}
+/*============================================================================*/
+/* size_t qIOUtil_BufStrLen( const char* buf, size_t size )
 
-    if( ( NULL == str ) || ( (size_t)0 == maxlen ) ){
-        count = 0;
-    }
-    else{
-        count = 0;
-        while( ( (char)'\0' != *str ) && ( maxlen > (size_t)0 ) ) {
-            ++count;
-            --maxlen;
-            ++str;
-        }        
-    }
-    return count;
+Same as qIOUtil_StrLen, for a string stored in a buffer of <size> bytes. Every
+byte of the buffer must be readable : on 32/64-bit cores the buffer is scanned 
+in whole aligned words.
+
+Parameters:
+
+    - buf : pointer to the buffer holding the string
+    - size : The size of the buffer in bytes
+
+Return value:
+
+  The length of the string on success, zero if <buf> is a null pointer, <size> 
+  if the null character was not found.
+*/
+size_t qIOUtil_BufStrLen( const char* buf, size_t size ){
+    return ( NULL != buf )? qIOUtil_StrScan( buf, '\0', size, qTrue ) : 0u;
 }
 /*============================================================================*/
 /*size_t qIOUtil_StrlCpy( char * dst, const char * src, size_t maxlen )
@@ -130,23 +321,54 @@ size_t qIOUtil_StrlCpy( char * dst, const char * src, size_t maxlen ){
 /*============================================================================*/
 /*makes the basic conversion of unsigned integer to ASCII. NULL Terminator not included*/
 static size_t qIOUtil_xBase_U32toA( qUINT32_t num, char* str, qUINT8_t base ){
-    size_t i = 0u;
+    char tmp[ 32 ]; /*digits are produced from the least significant one, enough for 32 bits in base 2*/
+    size_t i = sizeof(tmp);
     
-    if( ( 0uL == num ) || ( 0u == base ) ){ /* Handle 0 explicitly, otherwise empty string is printed for 0 */
-        str[ i++ ] = '0';  /*MISRAC2004-17.4_b deviation allowed*/        
+    if( ( 0uL == num ) || ( base < 2u ) || ( base > 36u ) ){ /* Handle 0 explicitly, otherwise empty string is printed for 0 */
+        tmp[ --i ] = '0';
+    }
+    else if( 10u == base ){ /*two digits per division using the digit-pair table*/
+        size_t r;
+
+        while( num >= 100uL ){
+            const qUINT32_t q = num/100uL;
+
+            r = (size_t)( num - ( q*100uL ) )*2u;
+            tmp[ --i ] = qIOUtil_DigitPairs[ r + 1u ];
+            tmp[ --i ] = qIOUtil_DigitPairs[ r ];
+            num = q;
+        }
+        if( num >= 10uL ){
+            r = (size_t)num*2u;
+            tmp[ --i ] = qIOUtil_DigitPairs[ r + 1u ];
+            tmp[ --i ] = qIOUtil_DigitPairs[ r ];
+        }
+        else{
+            tmp[ --i ] = qIOUtil_Digits[ num ];
+        }
+    }
+    else if( 0u == ( base & ( base - 1u ) ) ){ /*power-of-two bases : shift and mask instead of dividing*/
+        const qUINT32_t mask = (qUINT32_t)base - 1uL;
+        qUINT8_t shift = 0u;
+
+        while( ( 1uL << shift ) < (qUINT32_t)base ){
+            ++shift;
+        }
+        while( 0uL != num ){
+            tmp[ --i ] = qIOUtil_Digits[ num & mask ];
+            num >>= shift;
+        }
     }
     else{
-        qUINT32_t rem;
         while( 0uL != num ){ /*Process individual digits*/
-            rem = num % (qUINT32_t)base;
-            /*cstat -CERT-INT30-C_a*/
-            str[ i++ ] = ( rem > 9uL )? (char)((qUINT8_t)( rem - 10uL ) + 'A' ) : (char)( (qUINT8_t)rem + '0' );
-            /*cstat +CERT-INT30-C_a*/
-            num = num/base;
+            const qUINT32_t q = num/(qUINT32_t)base;
+
+            tmp[ --i ] = qIOUtil_Digits[ num - ( q*(qUINT32_t)base ) ];
+            num = q;
         }
-        qIOUtil_SwapBytes( str, i );/*Reverse the string*/
     }
-    return i;       
+    (void)memcpy( str, &tmp[ i ], sizeof(tmp) - i ); /*already in order, no reversal required*/
+    return sizeof(tmp) - i;       
 }
 /*============================================================================*/
 static char qIOUtil_NibbleToX( qUINT8_t value ){
@@ -376,6 +598,284 @@ qUINT32_t qIOUtil_XtoU32( const char *s ) {
     return val;
 }
 /*============================================================================*/
+/*scales <x> by 10^<exp10> for the first approximation of the slow path: the exact 
+table is applied in its largest chunk while required, then once with the 
+remainder. Every step rounds, so the result is only within a few ulps*/
+static qFloat64_t qIOUtil_Pow10Scale( qFloat64_t x, int exp10 ){
+    const qBool_t negative = ( exp10 < 0 )? qTrue : qFalse;
+    unsigned int n = (unsigned int)( ( qTrue == negative )? -exp10 : exp10 );
+
+    if( n > QIOUTIL_ATOF_MAX_SCALE ){
+        n = QIOUTIL_ATOF_MAX_SCALE; /*anything beyond gives inf or zero anyway*/
+    }
+    while( n > (unsigned int)QIOUTIL_POW10_EXACT ){
+        x = ( qTrue == negative )? ( x/qIOUtil_Pow10[ QIOUTIL_POW10_EXACT ] ) : ( x*qIOUtil_Pow10[ QIOUTIL_POW10_EXACT ] );
+        n -= (unsigned int)QIOUTIL_POW10_EXACT;
+    }
+    return ( qTrue == negative )? ( x/qIOUtil_Pow10[ n ] ) : ( x*qIOUtil_Pow10[ n ] );
+}
+/*============================================================================*/
+static void qIOUtil_BigSet( qIOUtil_Big_t * const b, qIOUtil_Mantissa_t v ){
+    b->n = 0u;
+    while( 0u != v ){
+        b->d[ b->n++ ] = (qIOUtil_Limb_t)v;
+        v >>= QIOUTIL_BIG_LIMB_BITS;
+    }
+}
+/*============================================================================*/
+/*b = b*m + a*/
+static void qIOUtil_BigMulAdd( qIOUtil_Big_t * const b, const qIOUtil_Limb_t m, qIOUtil_Limb_t a ){
+    size_t i;
+
+    for( i = 0u ; i < b->n ; ++i ){
+        qIOUtil_Limb2_t t = ( (qIOUtil_Limb2_t)b->d[ i ]*(qIOUtil_Limb2_t)m ) + (qIOUtil_Limb2_t)a;
+
+        b->d[ i ] = (qIOUtil_Limb_t)t;
+        a = (qIOUtil_Limb_t)( t >> QIOUTIL_BIG_LIMB_BITS );
+    }
+    if( ( 0u != a ) && ( b->n < QIOUTIL_BIG_LIMBS ) ){
+        b->d[ b->n++ ] = a;
+    }
+}
+/*============================================================================*/
+static void qIOUtil_BigMulPow5( qIOUtil_Big_t * const b, unsigned int n ){
+    while( n > 0u ){
+        unsigned int i, k = ( n > QIOUTIL_BIG_POW5_STEP )? QIOUTIL_BIG_POW5_STEP : n;
+        qIOUtil_Limb_t p = 1u;
+
+        for( i = 0u ; i < k ; ++i ){
+            p *= 5u;
+        }
+        qIOUtil_BigMulAdd( b, p, 0u );
+        n -= k;
+    }
+}
+/*============================================================================*/
+static void qIOUtil_BigShiftLeft( qIOUtil_Big_t * const b, unsigned int bits ){
+    const size_t limbs = (size_t)( bits/QIOUTIL_BIG_LIMB_BITS );
+    const unsigned int r = bits % QIOUTIL_BIG_LIMB_BITS;
+
+    if( ( b->n > 0u ) && ( ( b->n + limbs + 1u ) <= QIOUTIL_BIG_LIMBS ) ){ /*the capacity covers the worst exponent*/
+        size_t i = b->n;
+
+        if( 0u == r ){
+            while( i > 0u ){
+                --i;
+                b->d[ i + limbs ] = b->d[ i ];
+            }
+        }
+        else{
+            b->d[ i + limbs ] = (qIOUtil_Limb_t)( b->d[ i - 1u ] >> ( QIOUTIL_BIG_LIMB_BITS - r ) );
+            while( i > 1u ){
+                --i;
+                b->d[ i + limbs ] = (qIOUtil_Limb_t)( ( (qIOUtil_Limb2_t)b->d[ i ] << r ) | (qIOUtil_Limb2_t)( b->d[ i - 1u ] >> ( QIOUTIL_BIG_LIMB_BITS - r ) ) );
+            }
+            b->d[ limbs ] = (qIOUtil_Limb_t)( (qIOUtil_Limb2_t)b->d[ 0 ] << r );
+            b->n++;
+        }
+        for( i = 0u ; i < limbs ; ++i ){
+            b->d[ i ] = 0u;
+        }
+        b->n += limbs;
+        if( 0u == b->d[ b->n - 1u ] ){
+            b->n--;
+        }
+    }
+}
+/*============================================================================*/
+/*b = b/d, returns the remainder*/
+static qIOUtil_Limb_t qIOUtil_BigDivSmall( qIOUtil_Big_t * const b, const qIOUtil_Limb_t d ){
+    qIOUtil_Limb2_t r = 0u;
+    size_t i;
+
+    for( i = b->n ; i > 0u ; --i ){
+        r = ( r << QIOUTIL_BIG_LIMB_BITS ) | (qIOUtil_Limb2_t)b->d[ i - 1u ];
+        b->d[ i - 1u ] = (qIOUtil_Limb_t)( r/(qIOUtil_Limb2_t)d );
+        r %= (qIOUtil_Limb2_t)d;
+    }
+    while( ( b->n > 0u ) && ( 0u == b->d[ b->n - 1u ] ) ){
+        b->n--;
+    }
+    return (qIOUtil_Limb_t)r;
+}
+/*============================================================================*/
+/*compares D*10^e10 against N*2^e2 exactly, returns -1, 0 or 1*/
+static int qIOUtil_BigCompareScaled( const qIOUtil_Big_t * const D, const int e10, const qIOUtil_Mantissa_t N, const int e2 ){
+    qIOUtil_Big_t A, B;
+    int RetValue = 0;
+    size_t i;
+
+    A = *D;
+    qIOUtil_BigSet( &B, N );
+    if( e10 >= 0 ){ /*10^e10 = 5^e10 * 2^e10, the powers of two are balanced with a single shift*/
+        qIOUtil_BigMulPow5( &A, (unsigned int)e10 );
+    }
+    else{
+        qIOUtil_BigMulPow5( &B, (unsigned int)( -e10 ) );
+    }
+    if( e2 >= e10 ){
+        qIOUtil_BigShiftLeft( &B, (unsigned int)( e2 - e10 ) );
+    }
+    else{
+        qIOUtil_BigShiftLeft( &A, (unsigned int)( e10 - e2 ) );
+    }
+    if( A.n != B.n ){
+        RetValue = ( A.n > B.n )? 1 : -1;
+    }
+    else{
+        for( i = A.n ; i > 0u ; --i ){
+            if( A.d[ i - 1u ] != B.d[ i - 1u ] ){
+                RetValue = ( A.d[ i - 1u ] > B.d[ i - 1u ] )? 1 : -1;
+                break;
+            }
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*correctly rounded conversion for the inputs out of the exact fast path. All the 
+significant digits of <s> are gathered in a big integer D (a non-zero tail beyond
+QIOUTIL_ATOF_BIG_DIGITS is kept as a sticky digit), then the candidate m*2^k 
+taken from <approx> is moved one ulp at a time while D*10^e lies beyond the 
+midpoints to its neighbors (AlgorithmR). The approximation is within a few ulps,
+so only a couple of exact comparisons are required*/
+static qFloat64_t qIOUtil_AtoFSlow( const char *s, const int expPart, const qFloat64_t approx ){
+    qIOUtil_Big_t D;
+    qIOUtil_Mantissa_t m;
+    qFloat64_t RetValue;
+    int e10 = expPart, k = 0, nd = 0;
+    qBool_t point_seen = qFalse, sticky = qFalse, done = qFalse;
+    char c;
+
+    D.n = 0u;
+    while( (char)'\0' != ( c = *s ) ){
+        if( ( '.' == c ) && ( qFalse == point_seen ) ){
+            point_seen = qTrue; 
+        }
+        else if( 0 != isdigit( (int)c ) ){
+            if( ( 0u == D.n ) && ( '0' == c ) ){
+                if( qTrue == point_seen ){
+                    --e10; /*leading zeros of the fraction*/
+                }
+            }
+            else if( nd < QIOUTIL_ATOF_BIG_DIGITS ){
+                qIOUtil_BigMulAdd( &D, 10u, (qIOUtil_Limb_t)( (qUINT8_t)c - (qUINT8_t)'0' ) );
+                ++nd;
+                if( qTrue == point_seen ){
+                    --e10;
+                }
+            }
+            else{
+                if( '0' != c ){
+                    sticky = qTrue;
+                }
+                if( qFalse == point_seen ){
+                    ++e10;
+                }
+            }
+        }
+        else{
+            break;
+        }
+        s++; /*MISRAC2004-17.4_a deviation allowed*/
+    }
+    if( qTrue == sticky ){ /*the value lies strictly above the kept digits*/
+        qIOUtil_BigMulAdd( &D, 10u, 1u );
+        ++nd;
+        --e10;
+    }
+    /*cstat -CERT-FLP36-C -CERT-FLP34-C*/
+    if( ( e10 + nd - 1 ) > DBL_MAX_10_EXP ){
+        m = QIOUTIL_ATOF_EXACT_MANTISSA >> 1;
+        k = QIOUTIL_ATOF_KMAX + 1; /*overflows to infinity*/
+        done = qTrue;
+    }
+    else if( ( e10 + nd ) <= QIOUTIL_ATOF_MIN_10 ){
+        m = 0u;
+        done = qTrue;
+    }
+    else if( approx > DBL_MAX ){
+        m = QIOUTIL_ATOF_EXACT_MANTISSA - 1u;
+        k = QIOUTIL_ATOF_KMAX;
+    }
+    else{ /*split the approximation in m*2^k, m is exact after the normalization*/
+        qFloat64_t f = approx;
+
+        while( f >= ( (qFloat64_t)QIOUTIL_ATOF_EXACT_MANTISSA*4294967296.0 ) ){
+            f *= 2.3283064365386963e-10; /*2^-32*/
+            k += 32;
+        }
+        while( f >= (qFloat64_t)QIOUTIL_ATOF_EXACT_MANTISSA ){
+            f *= 0.5;
+            ++k;
+        }
+        while( ( f*4294967296.0 < (qFloat64_t)( QIOUTIL_ATOF_EXACT_MANTISSA >> 1 ) ) && ( ( k - 32 ) >= QIOUTIL_ATOF_KMIN ) ){
+            f *= 4294967296.0;
+            k -= 32;
+        }
+        while( ( f < (qFloat64_t)( QIOUTIL_ATOF_EXACT_MANTISSA >> 1 ) ) && ( k > QIOUTIL_ATOF_KMIN ) ){
+            f *= 2.0;
+            --k;
+        }
+        m = (qIOUtil_Mantissa_t)f;
+    }
+    if( k < QIOUTIL_ATOF_KMIN ){
+        k = QIOUTIL_ATOF_KMIN;
+    }
+    while( qFalse == done ){
+        int cmp = qIOUtil_BigCompareScaled( &D, e10, ( 2u*m ) + 1u, k - 1 ); /*against the midpoint to the next value*/
+
+        if( ( cmp > 0 ) || ( ( 0 == cmp ) && ( 0u != ( m & 1u ) ) ) ){
+            if( QIOUTIL_ATOF_EXACT_MANTISSA == ++m ){
+                m = QIOUTIL_ATOF_EXACT_MANTISSA >> 1;
+                ++k;
+            }
+            done = ( ( 0 == cmp ) || ( k > QIOUTIL_ATOF_KMAX ) )? qTrue : qFalse;
+        }
+        else if( ( 0 == cmp ) || ( 0u == m ) ){
+            done = qTrue; /*a tie with an even candidate or nothing below*/
+        }
+        else{
+            const qBool_t binade = ( ( ( QIOUTIL_ATOF_EXACT_MANTISSA >> 1 ) == m ) && ( k > QIOUTIL_ATOF_KMIN ) )? qTrue : qFalse;
+
+            if( qTrue == binade ){ /*the value below has half the ulp*/
+                cmp = qIOUtil_BigCompareScaled( &D, e10, ( 4u*m ) - 1u, k - 2 );
+            }
+            else{
+                cmp = qIOUtil_BigCompareScaled( &D, e10, ( 2u*m ) - 1u, k - 1 );
+            }
+            if( ( cmp < 0 ) || ( ( 0 == cmp ) && ( 0u != ( m & 1u ) ) ) ){
+                if( qTrue == binade ){
+                    m = QIOUTIL_ATOF_EXACT_MANTISSA - 1u;
+                    --k;
+                }
+                else{
+                    --m;
+                }
+                done = ( 0 == cmp )? qTrue : qFalse;
+            }
+            else{
+                done = qTrue;
+            }
+        }
+    }
+    RetValue = (qFloat64_t)m; /*scaling by powers of two is exact down to the subnormals*/
+    for( ; k >= 32 ; k -= 32 ){
+        RetValue *= 4294967296.0;
+    }
+    for( ; k > 0 ; --k ){
+        RetValue *= 2.0;
+    }
+    for( ; k <= -32 ; k += 32 ){
+        RetValue *= 2.3283064365386963e-10;
+    }
+    for( ; k < 0 ; ++k ){
+        RetValue *= 0.5;
+    }
+    /*cstat +CERT-FLP36-C +CERT-FLP34-C*/
+    return RetValue;
+}
+/*============================================================================*/
 /* qFloat64_t qIOUtil_AtoF( const char *s )
 Parses the C string s, interpreting its content as a floating point number and 
 returns its value as a double(qFloat64_t). The function first discards as many 
@@ -396,61 +896,87 @@ Return value:
     a double(qFloat64_t) value.
     If no valid conversion could be performed, the function returns zero (0.0).
     If the converted value would be out of the range of representable values by
-    a double(qFloat64_t), it causes undefined behavior
+    a double(qFloat64_t), it returns infinity or zero.
+
+    > Note : The result is correctly rounded (to nearest, ties to even). The 
+             digits are gathered in an integer mantissa and scaled once by an exact 
+             power of ten when the mantissa fits in the double precision and the 
+             exponent is up to 22 (10 when double is a 32-bit float). Any other 
+             input is resolved with exact big integer comparisons, which is 
+             slower and takes up to 1.5KB of stack (200 bytes with a 32-bit double).
 */
 qFloat64_t qIOUtil_AtoF( const char *s ){
-    qFloat64_t rez = 0.0, fact;
-    qBool_t point_seen = qFalse;
-    int sgn = 1;
+    qIOUtil_Mantissa_t mantissa = 0u;
+    qFloat64_t RetValue;
+    int sgn = 1, exp10 = 0, expPart = 0, ndigits = 0;
+    qBool_t point_seen = qFalse, truncated = qFalse;
+    const char *digits;
     char c;
 
-    #if ( Q_ATOF_FULL == 1 )
-        int power2, powersign = 1;
-        qFloat64_t power = 1.0, efactor;
-    #endif
-   
     s = qIOUtil_DiscardWhitespaces( s, Q_IOUTIL_MAX_STRLEN );
     s = qIOUtil_CheckStrSign( s, &sgn );
-    /*cstat -CERT-FLP36-C*/
-    fact = ( qFloat64_t )sgn; /*CERT-FLP36-C deviation allowed*/
-
+    digits = s;
     while( (char)'\0' != ( c = *s) ) { /*MISRAC2004-17.4_a deviation allowed*/ 
-        if( '.' == c ){
+        if( ( '.' == c ) && ( qFalse == point_seen ) ){
             point_seen = qTrue; 
         }
         else if( 0 != isdigit( (int)c ) ){
-            if( qTrue == point_seen ){
-                fact *= 0.1;
+            if( ndigits < QIOUTIL_ATOF_MAX_DIGITS ){ /*gather the significant digits in the integer mantissa*/
+                mantissa = ( mantissa*10u ) + (qIOUtil_Mantissa_t)( (qUINT8_t)c - (qUINT8_t)'0' );
+                if( 0u != mantissa ){
+                    ++ndigits; /*leading zeros are not significant*/
+                }
+                if( qTrue == point_seen ){
+                    --exp10;
+                }
+            }
+            else{
+                if( '0' != c ){
+                    truncated = qTrue; /*the slow path takes the whole digits*/
+                }
+                if( qFalse == point_seen ){
+                    ++exp10; /*digits beyond the mantissa capacity only scale the integer part*/
+                }
             }
-            rez = rez * 10.0 + ( (double)c ) - ( (double)'0' ); /*CERT-FLP36-C deviation allowed*/
         }
         else{
             break;
         }
         s++;
     }
-    /*cstat +CERT-FLP36-C*/
     #if ( Q_ATOF_FULL == 1 )
     if( ( 'e'  == *s ) || ( 'E' == *s ) ){
+        int power2 = 0, powersign = 1;
+
 	    s++;
 	    if( ( '-' == *s ) || ( '+' == *s ) ){
 		    powersign = ( '-' == *s )? -1 : 1;
             s++;    
         } 
-        for( power2 = 0; isdigit( *s ); s++ ){
-            power2 = power2 * 10 + ( *s - '0' );
-        }
-        if( power2 > 0){
- 		    efactor = ( -1 == powersign )? 0.1 : 10.0;
-        	for( power = 1; 0 != power2; power2-- ){
-            	power *= efactor;
-            }	
-	    }
+        for( ; 0 != isdigit( (int)*s ) ; s++ ){
+            if( power2 < QIOUTIL_ATOF_MAX_EXP ){ /*saturate, anything beyond gives inf or zero anyway*/
+                power2 = ( power2*10 ) + (int)( *s - '0' );
+            }
+        }
+        expPart = powersign*power2;
+        exp10 += expPart;
     }    
-    return power * rez * fact;   
-    #else
-        return rez * fact;
     #endif      
+    /*cstat -CERT-FLP36-C*/
+    RetValue = (qFloat64_t)mantissa; /*CERT-FLP36-C deviation allowed*/
+    /*cstat +CERT-FLP36-C*/
+    if( 0u != mantissa ){
+        if( ( qFalse == truncated ) && ( mantissa <= QIOUTIL_ATOF_EXACT_MANTISSA ) && 
+            ( exp10 >= -QIOUTIL_POW10_EXACT ) && ( exp10 <= QIOUTIL_POW10_EXACT ) ){
+            /*Clinger fast path : the mantissa and the power of ten are exact, so the
+            single rounding of the multiplication or division is the correct one*/
+            RetValue = ( exp10 < 0 )? ( RetValue/qIOUtil_Pow10[ -exp10 ] ) : ( RetValue*qIOUtil_Pow10[ exp10 ] );
+        }
+        else{
+            RetValue = qIOUtil_AtoFSlow( digits, expPart, qIOUtil_Pow10Scale( RetValue, exp10 ) );
+        }
+    }
+    return ( sgn < 0 )? -RetValue : RetValue;   
 }
 /*============================================================================*/
 /* char* qIOUtil_FtoA( qFloat32_t f, char *str, qUINT8_t precision )
@@ -462,21 +988,22 @@ Parameters:
     - num : Value to be converted to a string.
     - str : Array in memory where to store the resulting null-terminated string.
     - precision: Desired number of significant fractional digits in the string.
-                 (The max allowed precision is MAX_FTOA_PRECISION=10)
+                 (The max allowed precision is Q_MAX_FTOA_PRECISION, up to 12)
+
+    > Note : The conversion is exact and the last digit is correctly rounded 
+             (ties to even), as printf("%.*f") does. The float is split in its 
+             24-bit mantissa and exponent, the fraction bits are scaled once by
+             an integer power of ten and the result is formatted with the 
+             integer converter. <str> should be long enough for the whole float
+             range : up to 54 characters with the precision of 12.
 
 Return value:
 
   A pointer to the resulting null-terminated string, same as parameter <str>
 */
-char* qIOUtil_FtoA( qFloat32_t num, char *str, qUINT8_t precision ){ /*limited to precision=10*/
+char* qIOUtil_FtoA( qFloat32_t num, char *str, qUINT8_t precision ){ /*limited to precision=Q_MAX_FTOA_PRECISION*/
     if( NULL != str ){
-        if( ( num >= 0.0f ) && ( num < 1.0E-38 ) ){ /*handle the 0.0f*/
-            str[ 0 ] = '0';  /*MISRAC2004-17.4_b deviation allowed*/
-            str[ 1 ] = '.';  /*MISRAC2004-17.4_b deviation allowed*/
-            str[ 2 ] = '0';  /*MISRAC2004-17.4_b deviation allowed*/
-            str[ 3 ] = (char)'\0'; /*MISRAC2004-17.4_b deviation allowed*/       
-        }
-        else if( qTrue == qIOUtil_IsInf(num) ){ /*handle the infinity*/
+        if( qTrue == qIOUtil_IsInf(num) ){ /*handle the infinity*/
             str[ 0 ] = ( num > 0.0f )? '+' : '-'; /*MISRAC2004-17.4_b deviation allowed*/
             str[ 1 ] = 'i';  /*MISRAC2004-17.4_b deviation allowed*/
             str[ 2 ] = 'n';  /*MISRAC2004-17.4_b deviation allowed*/
@@ -490,34 +1017,106 @@ char* qIOUtil_FtoA( qFloat32_t num, char *str, qUINT8_t precision ){ /*limited t
             str[ 3 ] = (char)'\0'; /*MISRAC2004-17.4_b deviation allowed*/
         }
         else{
-            qUINT32_t intPart;
-            size_t i = 0u;
+            qUINT32_t u = 0uL, m, intPart = 0uL;
+            qUINT64_t fracPart = 0uLL;
+            size_t i = 0u, n;
+            int e2;
+            char tmp[ 40 ];
 
             if( precision > Q_MAX_FTOA_PRECISION ){
                 precision = Q_MAX_FTOA_PRECISION; /*clip the precision*/
             }
-            
-            if( num < 0.0f ){ /*handle the negative numbers*/
-                num = -num; /*leave it positive for the convert method*/
+            (void)memcpy( &u, &num, sizeof(u) );
+            if( 0uL != ( u & 0x80000000uL ) ){ /*handle the negative numbers*/
                 str[ i++ ] = '-'; /*add the negative sign*/
             }
-            
-            intPart = (qUINT32_t)num; /*get the integer parts*/
-            /*cstat -CERT-FLP36-C*/
-            num -= (qFloat32_t)intPart; /*get the floating-point part subtracting the integer part from the original value*/ /*CERT-FLP36-C deviation allowed*/
-            i += qIOUtil_xBase_U32toA( intPart, &str[ i ], 10u ); /*convert the integer part in decimal form*/
+            m = u & 0x007FFFFFuL; /*num = m*2^e2*/
+            e2 = (int)( ( u >> 23 ) & 0xFFuL );
+            if( 0 != e2 ){
+                m |= 0x00800000uL; /*the implicit bit of the normal numbers*/
+            }
+            else{
+                e2 = 1; /*subnormal*/
+            }
+            e2 -= 150;
+            if( e2 >= 9 ){ /*beyond 32 bits : an integer, converted exactly in chunks of decimal digits*/
+                qIOUtil_Big_t b;
+                qIOUtil_Limb_t chunk = 1u;
+                size_t k;
+
+                for( k = 0u ; k < QIOUTIL_BIG_DEC_STEP ; ++k ){
+                    chunk *= 10u;
+                }
+                qIOUtil_BigSet( &b, (qIOUtil_Mantissa_t)m );
+                qIOUtil_BigShiftLeft( &b, (unsigned int)e2 );
+                n = 0u;
+                while( b.n > 0u ){
+                    qIOUtil_Limb_t r = qIOUtil_BigDivSmall( &b, chunk );
+
+                    for( k = 0u ; ( k < QIOUTIL_BIG_DEC_STEP ) && ( ( b.n > 0u ) || ( 0u != r ) ) ; ++k ){
+                        tmp[ n++ ] = (char)( '0' + (char)( r % 10u ) ); /*reversed*/
+                        r /= 10u;
+                    }
+                }
+                while( n > 0u ){
+                    str[ i++ ] = tmp[ --n ];
+                }
+            }
+            else if( e2 >= 0 ){
+                intPart = m << e2;
+            }
+            else{ /*scale the fraction bits by 10^precision and round to nearest, ties to even*/
+                const unsigned int sh = (unsigned int)( -e2 );
+                qUINT64_t scaled;
+
+                intPart = ( sh < 32u )? ( m >> sh ) : 0uL;
+                scaled = (qUINT64_t)( ( sh < 32u )? ( m & ( ( 1uL << sh ) - 1uL ) ) : m )*qIOUtil_FtoAPow10[ precision ];
+                if( sh < 64u ){
+                    const qUINT64_t half = (qUINT64_t)1u << ( sh - 1u );
+                    const qUINT64_t rem = scaled & ( ( half << 1 ) - 1u );
+
+                    const qUINT64_t last = ( 0u == precision )? (qUINT64_t)intPart : ( scaled >> sh ); /*the digit the tie goes to*/
+
+                    fracPart = scaled >> sh;
+                    if( ( rem > half ) || ( ( rem == half ) && ( 0u != ( last & 1u ) ) ) ){
+                        ++fracPart;
+                    }
+                }
+                else if( ( 64u == sh ) && ( scaled > ( (qUINT64_t)1u << 63 ) ) ){ /*above the half of the last digit, a tie rounds to the even zero*/
+                    fracPart = 1u;
+                }
+                else{
+                    /*below the half of the last digit : rounds to zero*/
+                }
+                if( fracPart >= qIOUtil_FtoAPow10[ precision ] ){ /*the rounding carries to the integer part*/
+                    fracPart -= qIOUtil_FtoAPow10[ precision ];
+                    ++intPart;
+                }
+            }
+            if( e2 < 9 ){
+                i += qIOUtil_xBase_U32toA( intPart, &str[ i ], 10u ); /*convert the integer part in decimal form*/
+            }
             if( precision > 0u ){ /*decimal part*/
-                char c;
+                size_t zeros;
 
                 str[ i++ ] = '.'; /*place decimal point*/ /*MISRAC2004-17.4_b deviation allowed*/
-                while( 0u != precision-- ){ /*convert until precision reached*/
-                    num *= 10.0f;  /*start moving the floating-point part one by one multiplying by 10*/
-                    c = (char)num; /*get the bcd byte*/
-                    str[ i++ ] = (char) ((qUINT8_t)c + '0' ); /*convert to ASCII and put it inside the buffer*/
-                    num -= (qFloat32_t)c; /*Subtract the processed floating-point digit*/
+                if( precision > 9u ){ /*split it in two 32-bit halves for the integer converter*/
+                    n = qIOUtil_xBase_U32toA( (qUINT32_t)( fracPart/1000000000uLL ), tmp, 10u );
+                    for( zeros = (size_t)precision - 9u - n ; zeros > 0u ; --zeros ){
+                        str[ i++ ] = '0';
+                    }
+                    (void)memcpy( &str[ i ], tmp, n );
+                    i += n;
+                    fracPart %= 1000000000uLL;
+                    precision = 9u;
+                }
+                n = qIOUtil_xBase_U32toA( (qUINT32_t)fracPart, tmp, 10u );
+                for( zeros = (size_t)precision - n ; zeros > 0u ; --zeros ){ /*leading zeros of the fraction*/
+                    str[ i++ ] = '0';
                 }
+                (void)memcpy( &str[ i ], tmp, n );
+                i += n;
             }
-            /*cstat +CERT-FLP36-C*/
             str[ i ] = (char)'\0'; /*put the null char*/ /*MISRAC2004-17.4_b deviation allowed*/
         }
     }
@@ -742,3 +1341,202 @@ qBool_t qIOUtil_IsNan( qFloat32_t f ){
     return ( ( 0x7F800000uL == ( u & 0x7F800000uL ) ) && ( 0uL != (u & 0x7FFFFFuL) ) )? qTrue : qFalse;
 }
 /*============================================================================*/
+static void qIOUtil_PrintfFlush( qIOUtil_PrintfHandler_t * const h ){
+    if( h->count > 0u ){
+        h->buffer[ h->count ] = (char)'\0';
+        h->fcn( h->pStorage, h->buffer ); /*a single call for the whole block*/
+        h->count = 0u;
+    }
+}
+/*============================================================================*/
+static void qIOUtil_PrintfPut( qIOUtil_PrintfHandler_t * const h, const char *s, size_t n ){
+    h->total += n;
+    while( n > 0u ){
+        size_t chunk = ( h->size - 1u ) - h->count; /*room left, one place is kept for the null terminator*/
+
+        if( chunk > n ){
+            chunk = n;
+        }
+        (void)memcpy( &h->buffer[ h->count ], s, chunk );
+        h->count += chunk;
+        s = &s[ chunk ];
+        n -= chunk;
+        if( ( h->size - 1u ) == h->count ){
+            qIOUtil_PrintfFlush( h );
+        }
+    }
+}
+/*============================================================================*/
+static void qIOUtil_PrintfPad( qIOUtil_PrintfHandler_t * const h, const char c, size_t n ){
+    while( n > 0u ){
+        qIOUtil_PrintfPut( h, &c, 1u );
+        --n;
+    }
+}
+/*============================================================================*/
+/*size_t qIOUtil_Printf( qPutString_t fcn, void* pStorage, char *buffer, size_t size, const char *fmt, ... )
+
+Write a formatted string through <fcn>. The output is collected in the caller 
+<buffer> and flushed in blocks of up to <size>-1 characters, so <fcn> is called 
+once per block instead of once per character.
+
+The supported format specification is: %[flags][width][.precision][l]specifier
+
+    - flags : '-' left-justify, '0' pad with zeros.
+    - width : Minimum number of characters to be written.
+    - precision : Number of fractional digits for 'f' (6 by default, max 
+                  Q_MAX_FTOA_PRECISION) or max number of characters for 's'.
+    - l : the argument is a long (d,i,u,x,X,o,b).
+    - specifier : d/i signed decimal, u unsigned decimal, x/X hexadecimal, 
+                  o octal, b binary, f floating-point, c character, s string
+                  and % for a literal '%'.
+
+Parameters:
+
+    - fcn : The basic output string function
+    - pStorage : The storage pointer passed to <fcn>
+    - buffer : The buffer used to collect the output before flushing it.
+    - size : The size of <buffer>. Should be at least 2.
+    - fmt : The format string.
+
+Return value:
+
+    The number of characters written.
+*/
+size_t qIOUtil_Printf( qPutString_t fcn, void* pStorage, char *buffer, size_t size, const char *fmt, ... ){
+    qIOUtil_PrintfHandler_t h = { NULL, NULL, NULL, 0u, 0u, 0u };
+
+    if( ( NULL != fcn ) && ( NULL != buffer ) && ( size >= 2u ) && ( NULL != fmt ) ){
+        va_list args;
+
+        h.fcn = fcn;
+        h.pStorage = pStorage;
+        h.buffer = buffer;
+        h.size = size;
+        va_start( args, fmt );
+        while( (char)'\0' != *fmt ){
+            const char *lit = fmt;
+
+            while( ( (char)'\0' != *fmt ) && ( '%' != *fmt ) ){ /*literal text is copied in a single block*/
+                ++fmt;
+            }
+            qIOUtil_PrintfPut( &h, lit, (size_t)( fmt - lit ) );
+            if( '%' == *fmt ){
+                char tmp[ 56 ]; /*enough for any integer in base 2 or the qIOUtil_FtoA output*/
+                const char *out = tmp;
+                size_t len = 0u, width = 0u, precision = (size_t)~0u;
+                qBool_t left = qFalse, zero = qFalse, islong = qFalse;
+                qUINT8_t base = 0u;
+
+                ++fmt;
+                while( ( '-' == *fmt ) || ( '0' == *fmt ) ){
+                    if( '-' == *fmt ){
+                        left = qTrue;
+                    }
+                    else{
+                        zero = qTrue;
+                    }
+                    ++fmt;
+                }
+                while( 0 != isdigit( (int)*fmt ) ){
+                    width = ( width*10u ) + (size_t)( *fmt - '0' );
+                    ++fmt;
+                }
+                if( '.' == *fmt ){
+                    ++fmt;
+                    precision = 0u;
+                    while( 0 != isdigit( (int)*fmt ) ){
+                        precision = ( precision*10u ) + (size_t)( *fmt - '0' );
+                        ++fmt;
+                    }
+                }
+                if( 'l' == *fmt ){
+                    islong = qTrue;
+                    ++fmt;
+                }
+                switch( *fmt ){
+                    case 'd': case 'i':
+                        {
+                            const long value = ( qTrue == islong )? va_arg( args, long ) : (long)va_arg( args, int );
+                            qUINT32_t magnitude = (qUINT32_t)value;
+
+                            if( value < 0L ){
+                                tmp[ len++ ] = '-';
+                                magnitude = 0uL - magnitude;
+                            }
+                            len += qIOUtil_xBase_U32toA( magnitude, &tmp[ len ], 10u );
+                        }
+                        break;
+                    case 'u':
+                        base = 10u;
+                        break;
+                    case 'x': case 'X':
+                        base = 16u;
+                        break;
+                    case 'o':
+                        base = 8u;
+                        break;
+                    case 'b':
+                        base = 2u;
+                        break;
+                    case 'f':
+                        if( precision > Q_MAX_FTOA_PRECISION ){
+                            precision = ( (size_t)~0u == precision )? 6u : Q_MAX_FTOA_PRECISION;
+                        }
+                        (void)qIOUtil_FtoA( (qFloat32_t)va_arg( args, double ), tmp, (qUINT8_t)precision );
+                        len = qIOUtil_StrLen( tmp, sizeof(tmp) );
+                        break;
+                    case 'c':
+                        tmp[ 0 ] = (char)va_arg( args, int );
+                        len = 1u;
+                        break;
+                    case 's':
+                        out = va_arg( args, const char* );
+                        if( NULL == out ){
+                            out = "(null)";
+                        }
+                        len = qIOUtil_StrLen( out, ( precision < Q_IOUTIL_MAX_STRLEN )? precision : Q_IOUTIL_MAX_STRLEN );
+                        zero = qFalse;
+                        break;
+                    case '\0':
+                        --fmt; /*incomplete specification at the end of the format string*/
+                        break;
+                    default: /*'%' and unknown specifiers are written as they are*/
+                        tmp[ 0 ] = *fmt;
+                        len = 1u;
+                        break;
+                }
+                if( base > 0u ){
+                    const qUINT32_t value = ( qTrue == islong )? (qUINT32_t)va_arg( args, unsigned long ) : (qUINT32_t)va_arg( args, unsigned int );
+
+                    len = qIOUtil_xBase_U32toA( value, tmp, base );
+                    if( 'x' == *fmt ){
+                        size_t i;
+
+                        for( i = 0u ; i < len ; ++i ){
+                            tmp[ i ] = (char)tolower( (int)tmp[ i ] );
+                        }
+                    }
+                }
+                if( ( qFalse == left ) && ( width > len ) ){
+                    if( ( qTrue == zero ) && ( out == tmp ) && ( '-' == tmp[ 0 ] ) ){ /*the sign goes before the zeros*/
+                        qIOUtil_PrintfPut( &h, out, 1u );
+                        out = &tmp[ 1 ];
+                        --len;
+                        --width;
+                    }
+                    qIOUtil_PrintfPad( &h, ( qTrue == zero )? '0' : ' ', width - len );
+                }
+                qIOUtil_PrintfPut( &h, out, len );
+                if( ( qTrue == left ) && ( width > len ) ){
+                    qIOUtil_PrintfPad( &h, ' ', width - len );
+                }
+                ++fmt;
+            }
+        }
+        va_end( args );
+        qIOUtil_PrintfFlush( &h );
+    }
+    return h.total;
+}
+/*============================================================================*/
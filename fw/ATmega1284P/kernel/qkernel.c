@@ -21,8 +21,32 @@ typedef qUINT32_t qCoreFlags_t;
 typedef struct{
     qTask_NotifyMode_t mode;
     void *eventdata;
+    #if ( Q_NOTIFICATION_TOPICS > 0 )
+        qTopic_t topics;    /*< The target topics (0 = all the tasks). */
+    #endif
 }qNotificationSpreader_t;
 
+#if ( Q_CPU_LOAD_MONITOR == 1 )
+    #define QKERNEL_ACTIVITY_IDLE       ( 0u )  /*< Running the idle-task. */
+    #define QKERNEL_ACTIVITY_TASK       ( 1u )  /*< Running a task callback. */
+    #define QKERNEL_ACTIVITY_KERNEL     ( 2u )  /*< Scheduler overhead. */
+    #define QKERNEL_ACTIVITY_POLL       ( 3u )  /*< Checking for ready tasks, resolved as idle or overhead at the end of the check. */
+    #define QKERNEL_ACTIVITIES          ( 3u )
+
+    #define QKERNEL_SET_ACTIVITY( ACT )     qOS_CPULoad_Switch( ACT )
+
+    typedef struct{
+        qUINT32_t Window[ Q_CPU_LOAD_WINDOW ][ QKERNEL_ACTIVITIES ];   /*< The time spent on every activity in the closed slots. */
+        qUINT64_t Spent[ QKERNEL_ACTIVITIES + 1u ];                     /*< The time spent on every activity in the current slot. */
+        qUINT64_t Stamp;                                                /*< The timestamp of the last activity switch. */
+        qClock_t SlotStart;                                             /*< The epoch where the current slot started. */
+        qIndex_t Slot;                                                  /*< The index of the next slot to be written. */
+        qUINT8_t Activity;                                              /*< The current kernel activity. */
+    }qCPULoad_t;
+#else
+    #define QKERNEL_SET_ACTIVITY( ACT )
+#endif
+
 typedef struct{ /*KCB(Kernel Control Block) definition*/
     qList_t CoreLists[ Q_PRIORITY_LEVELS + 2 ];
     qTaskFcn_t IDLECallback;                            /*< The callback function that represents the idle-task activities. */
@@ -40,9 +64,18 @@ typedef struct{ /*KCB(Kernel Control Block) definition*/
     #if ( Q_NOTIFICATION_SPREADER == 1 )
         volatile qNotificationSpreader_t NotificationSpreadRequest;
     #endif
+    #if ( Q_NOTIFICATION_TOPICS > 0 )
+        qTask_t *TopicSubscribers[ Q_NOTIFICATION_TOPICS ]; /*< The subscribers list of every topic. */
+    #endif
     #if ( Q_PRESERVE_TASK_ENTRY_ORDER == 1)
         size_t TaskEntries;                             /*< Used to hold the number of task entries*/
     #endif
+    #if ( QTASK_DEADLINES == 1 )
+        qTaskDeadlineMissFcn_t DeadlineMissCallback;    /*< The callback function to report a deadline miss. */
+    #endif
+    #if ( Q_CPU_LOAD_MONITOR == 1 )
+        qCPULoad_t CPU;                                 /*< The CPU load accounting. */
+    #endif
 }qKernelControlBlock_t;
 
 /*=========================== Kernel Control Block ===========================*/
@@ -72,6 +105,15 @@ static qTrigger_t qOS_Dispatch_xTask_FillEventInfo( qTask_t *Task );
     static qTrigger_t qOS_AttachedQueue_CheckEvents( const qTask_t * const Task );
 #endif
 
+#if ( Q_NOTIFICATION_TOPICS > 0 )
+    static void qOS_Notification_Unlink( qTask_t * const Task, const qIndex_t Topic );
+    static void qOS_Notification_DeliverTopics( const qNotificationSpreader_t * const Spread );
+#endif
+
+#if ( Q_COROUTINE_WAITS == 1 )
+    static qTrigger_t qOS_CoroutineWait_CheckEvents( qTask_t * const Task );
+#endif
+
 #if ( Q_ATCLI == 1)
     static void qOS_ATCLI_TaskCallback( qEvent_t  e );
     static void qOS_ATCLI_NotifyFcn( qATCLI_t * const cli );
@@ -81,6 +123,24 @@ static qTrigger_t qOS_Dispatch_xTask_FillEventInfo( qTask_t *Task );
     static qBool_t qOS_TaskEntryOrderPreserver( qList_CompareHandle_t h );
 #endif
 
+#if ( Q_CPU_LOAD_MONITOR == 1 )
+    static void qOS_CPULoad_Switch( const qUINT8_t Activity );
+    static void qOS_CPULoad_ResolvePoll( const qBool_t Busy );
+    #if ( Q_ATCLI == 1)
+        static qATCLI_Response_t qOS_ATCLI_CPULoadCmdCallback( qATCLI_Handler_t h );
+    #endif
+#endif
+
+#if ( QTASK_DEADLINES == 1 )
+    static qClock_t qOS_Task_RelativeDeadline( const qTask_t * const Task );
+    static qClock_t qOS_Task_Reschedule( qTask_t * const Task );
+    static void qOS_Task_CheckDeadline( qTask_t * const Task );
+#endif
+
+#if ( Q_SCHEDULER_EDF == 1 )
+    static qList_Position_t qOS_EDF_GetPosition( const qList_t * const xList, const qTask_t * const Task );
+#endif
+
 /*========================== Shared Private Method ===========================*/
 void qOS_DummyTask_Callback( qEvent_t e ){
     Q_UNUSED( e ); 
@@ -99,7 +159,8 @@ Parameters:
 
     - BaseTimming (Optional) : This parameter specifies the ISR background timer base time.
                     This can be the period in seconds(Floating-point format) or frequency 
-                    in Herzt(Only if Q_SETUP_TICK_IN_HERTZ is enabled).
+                    in Herzt(Only if Q_SETUP_TICK_IN_HERTZ is enabled, mandatory for
+                    Q_SETUP_TIME_FIXEDPOINT).
 
     - IdleCallback : Callback function to the Idle Task. To disable the 
                     Idle Task activities, pass NULL as argument.
@@ -132,6 +193,12 @@ Parameters:
         kernel.NotificationSpreadRequest.mode = qTask_NotifyNULL;
         kernel.NotificationSpreadRequest.eventdata = NULL;
     #endif    
+    #if ( Q_NOTIFICATION_TOPICS > 0 )
+        kernel.NotificationSpreadRequest.topics = 0uL;
+        for( i = 0u ; i < (qIndex_t)Q_NOTIFICATION_TOPICS ; i++ ){
+            kernel.TopicSubscribers[ i ] = NULL;
+        }
+    #endif
     kernel.Flag = 0uL; /*clear all the core flags*/
     #if ( Q_ALLOW_SCHEDULER_RELEASE == 1 )
         kernel.ReleaseSchedCallback = NULL;
@@ -139,8 +206,19 @@ Parameters:
     #if ( Q_PRESERVE_TASK_ENTRY_ORDER == 1)
         kernel.TaskEntries = (size_t)0;
     #endif
+    #if ( QTASK_DEADLINES == 1 )
+        kernel.DeadlineMissCallback = NULL;
+    #endif
+    #if ( Q_CPU_LOAD_MONITOR == 1 )
+        (void)memset( (void*)&kernel.CPU, 0, sizeof(qCPULoad_t) );
+    #endif
     kernel.CurrentRunningTask = NULL;
     qClock_SetTickProvider( TickProvider );
+    #if ( Q_CPU_LOAD_MONITOR == 1 )
+        kernel.CPU.Stamp = qClock_GetTimestamp();
+        kernel.CPU.SlotStart = qClock_GetTick();
+        kernel.CPU.Activity = QKERNEL_ACTIVITY_KERNEL;
+    #endif
 }
 /*========================== Shared Private Method ===========================*/
 qTask_t* qOS_Get_TaskRunning( void ){
@@ -183,6 +261,157 @@ void qOS_Set_SchedulerReleaseCallback( qTaskFcn_t Callback ){
     kernel.ReleaseSchedCallback = Callback;
 }
 #endif /* #if ( Q_ALLOW_SCHEDULER_RELEASE == 1 ) */
+#if ( QTASK_DEADLINES == 1 )
+/*============================================================================*/
+/*void qOS_Set_DeadlineMissCallback( qTaskDeadlineMissFcn_t Callback )
+
+Set/Change the global callback function used to report deadline misses. The 
+callback is invoked right after a task finishes its activities past its absolute
+deadline. See <qTask_Set_Deadline>.
+
+Parameters:
+
+    - Callback : A pointer to a void callback method with the task node and the 
+                 lateness in epochs as input arguments. To disable the report,
+                 pass NULL as argument.
+*/
+void qOS_Set_DeadlineMissCallback( qTaskDeadlineMissFcn_t Callback ){
+    kernel.DeadlineMissCallback = Callback;
+}
+#endif /* #if ( QTASK_DEADLINES == 1 ) */
+#if ( Q_CPU_LOAD_MONITOR == 1 )
+/*============================================================================*/
+static void qOS_CPULoad_Switch( const qUINT8_t Activity ){
+    qUINT64_t Now = qClock_GetTimestamp();
+
+    kernel.CPU.Spent[ kernel.CPU.Activity ] += Now - kernel.CPU.Stamp; /*account the real duration of the outgoing activity*/
+    kernel.CPU.Stamp = Now;
+    kernel.CPU.Activity = Activity;
+    if( ( QKERNEL_ACTIVITY_POLL != Activity ) && ( qClock_TimeDeadlineCheck( kernel.CPU.SlotStart, (qClock_t)Q_CPU_LOAD_SLOT_EPOCHS ) ) ){ /*close the current slot*/
+        qIndex_t i;
+
+        for( i = 0u ; i < (qIndex_t)QKERNEL_ACTIVITIES ; ++i ){
+            kernel.CPU.Window[ kernel.CPU.Slot ][ i ] = ( kernel.CPU.Spent[ i ] > 0xFFFFFFFFuLL )? 0xFFFFFFFFuL : (qUINT32_t)kernel.CPU.Spent[ i ];
+            kernel.CPU.Spent[ i ] = 0uLL;
+        }
+        kernel.CPU.SlotStart = qClock_GetTick();
+        if( ++kernel.CPU.Slot >= (qIndex_t)Q_CPU_LOAD_WINDOW ){
+            kernel.CPU.Slot = 0u;
+        }
+    }
+}
+/*============================================================================*/
+static void qOS_CPULoad_ResolvePoll( const qBool_t Busy ){
+    if( qTrue == Busy ){ /*the polling ended with ready tasks, it was scheduler overhead*/
+        kernel.CPU.Spent[ QKERNEL_ACTIVITY_KERNEL ] += kernel.CPU.Spent[ QKERNEL_ACTIVITY_POLL ];
+    }
+    else{
+        kernel.CPU.Spent[ QKERNEL_ACTIVITY_IDLE ] += kernel.CPU.Spent[ QKERNEL_ACTIVITY_POLL ];
+    }
+    kernel.CPU.Spent[ QKERNEL_ACTIVITY_POLL ] = 0uLL;
+}
+/*============================================================================*/
+/*qBool_t qOS_Get_CPUUsage( qOS_CPUUsage_t * const Usage )
+
+Retrieve the CPU usage over the sliding window of the last 
+Q_CPU_LOAD_WINDOW * Q_CPU_LOAD_SLOT_EPOCHS epochs. The usage is obtained by 
+measuring the duration of every kernel activity with <qClock_GetTimestamp>, so
+a sub-tick provider should be set with <qClock_SetSubTickProvider>. Otherwise,
+the durations are measured in whole epochs and activities shorter than an 
+epoch are not properly accounted.
+
+Parameters:
+
+    - Usage : A pointer to the structure where the usage (in percent) of the 
+              idle-task, the task callbacks and the scheduler overhead will be 
+              written.
+
+Return value:
+
+    qTrue on success. qFalse if there are no samples available yet.
+*/
+qBool_t qOS_Get_CPUUsage( qOS_CPUUsage_t * const Usage ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Usage ){
+        qUINT64_t Sum[ QKERNEL_ACTIVITIES ] = { 0uLL, 0uLL, 0uLL };
+        qUINT64_t Total;
+        qIndex_t i;
+
+        for( i = 0u ; i < (qIndex_t)Q_CPU_LOAD_WINDOW ; ++i ){
+            Sum[ QKERNEL_ACTIVITY_IDLE ] += kernel.CPU.Window[ i ][ QKERNEL_ACTIVITY_IDLE ];
+            Sum[ QKERNEL_ACTIVITY_TASK ] += kernel.CPU.Window[ i ][ QKERNEL_ACTIVITY_TASK ];
+            Sum[ QKERNEL_ACTIVITY_KERNEL ] += kernel.CPU.Window[ i ][ QKERNEL_ACTIVITY_KERNEL ];
+        }
+        Total = Sum[ QKERNEL_ACTIVITY_IDLE ] + Sum[ QKERNEL_ACTIVITY_TASK ] + Sum[ QKERNEL_ACTIVITY_KERNEL ];
+        if( Total > 0uLL ){
+            Usage->Tasks = (qUINT8_t)( ( ( 100uLL*Sum[ QKERNEL_ACTIVITY_TASK ] ) + ( Total >> 1 ) )/Total );
+            Usage->Kernel = (qUINT8_t)( ( ( 100uLL*Sum[ QKERNEL_ACTIVITY_KERNEL ] ) + ( Total >> 1 ) )/Total );
+            Usage->Load = (qUINT8_t)( ( ( 100uLL*( Total - Sum[ QKERNEL_ACTIVITY_IDLE ] ) ) + ( Total >> 1 ) )/Total );
+            Usage->Idle = 100u - Usage->Load;
+            RetValue = qTrue;
+        }
+        else{
+            (void)memset( (void*)Usage, 0, sizeof(qOS_CPUUsage_t) );
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qUINT8_t qOS_Get_CPULoad( void )
+
+Retrieve the CPU load (time spent in tasks and in the scheduler overhead) over
+the sliding window. See <qOS_Get_CPUUsage>.
+
+Return value:
+
+    The CPU load in percent.
+*/
+qUINT8_t qOS_Get_CPULoad( void ){
+    qOS_CPUUsage_t Usage;
+
+    (void)qOS_Get_CPUUsage( &Usage );
+    return Usage.Load;
+}
+#if ( Q_ATCLI == 1 )
+/*============================================================================*/
+/*qBool_t qOS_ATCLI_CPULoadCmdSubscribe( qATCLI_t * const cli, qATCLI_Command_t * const Command )
+
+Subscribe the built-in "at+cpu" command to the AT Command Line Interface. When
+the command is sent as "at+cpu?" or "at+cpu", the CLI replies with the CPU usage
+in percent with the following format: +CPU:<load>,<idle>,<tasks>,<kernel>
+
+Parameters:
+
+    - cli : A pointer to the AT Command Line Inteface instance.
+    - Command : A pointer to the AT command object.
+
+Return value:
+
+    qTrue on success, otherwise return qFalse
+*/
+qBool_t qOS_ATCLI_CPULoadCmdSubscribe( qATCLI_t * const cli, qATCLI_Command_t * const Command ){
+    return qATCLI_CmdSubscribe( cli, Command, "at+cpu", qOS_ATCLI_CPULoadCmdCallback, QATCLI_CMDTYPE_READ | QATCLI_CMDTYPE_ACT, NULL );
+}
+/*============================================================================*/
+static qATCLI_Response_t qOS_ATCLI_CPULoadCmdCallback( qATCLI_Handler_t h ){
+    qOS_CPUUsage_t Usage;
+    char num[ 4 ] = { 0 };
+
+    (void)qOS_Get_CPUUsage( &Usage );
+    h->puts( "+CPU:" );
+    h->puts( qIOUtil_UtoA( (qUINT32_t)Usage.Load, num, 10u ) );
+    h->putch( ',' );
+    h->puts( qIOUtil_UtoA( (qUINT32_t)Usage.Idle, num, 10u ) );
+    h->putch( ',' );
+    h->puts( qIOUtil_UtoA( (qUINT32_t)Usage.Tasks, num, 10u ) );
+    h->putch( ',' );
+    h->puts( qIOUtil_UtoA( (qUINT32_t)Usage.Kernel, num, 10u ) );
+    h->puts( QATCLI_DEFAULT_EOL_STRING );
+    return qATCLI_OK;
+}
+#endif /* #if ( Q_ATCLI == 1 ) */
+#endif /* #if ( Q_CPU_LOAD_MONITOR == 1 ) */
 /*============================================================================*/
 /*qBool_t qOS_Notification_Spread( void *eventdata, const qTask_NotifyMode_t mode )
 
@@ -205,19 +434,175 @@ qBool_t qOS_Notification_Spread( void *eventdata, const qTask_NotifyMode_t mode
     
     #if ( Q_NOTIFICATION_SPREADER == 1 )
         /*do not proceed if any previous operation is in progress*/
+        qCritical_Enter();
         if( qTask_NotifyNULL ==  kernel.NotificationSpreadRequest.mode ){ 
             if( ( qTask_NotifySimple == mode ) || ( qTask_NotifyQueued == mode ) ){
                 kernel.NotificationSpreadRequest.mode = mode;
                 kernel.NotificationSpreadRequest.eventdata = eventdata;
+                #if ( Q_NOTIFICATION_TOPICS > 0 )
+                    kernel.NotificationSpreadRequest.topics = 0uL;
+                #endif
                 RetValue = qTrue;
             }
         }
+        qCritical_Exit();
     #else
         Q_UNUSED( eventdata );
         Q_UNUSED( mode );    
     #endif
     return RetValue;    
 }
+#if ( Q_NOTIFICATION_TOPICS > 0 )
+/*============================================================================*/
+/*qBool_t qOS_Notification_Subscribe( qTask_t * const Task, const qTopic_t Topics )
+
+Subscribe a task to one or more notification topics, so it will be notified by
+<qOS_Notification_SpreadTopics> when any of them is spread. Every topic keeps
+the list of its subscribers, so a topic spread only walks the subscribers.
+
+Note : Should not be called from interrupts.
+
+Parameters:
+
+    - Task : A pointer to the task node.
+    - Topics : The topic mask. Use QTOPIC(n) to build it, e.g.
+               QTOPIC( 0 ) | QTOPIC( 3 ).
+
+Return value:
+
+    qTrue on success. qFalse if the task or the topics are not valid.
+*/
+qBool_t qOS_Notification_Subscribe( qTask_t * const Task, const qTopic_t Topics ){
+    qBool_t RetValue = qFalse;
+
+    if( ( NULL != Task ) && ( 0uL != Topics ) ){
+        qIndex_t i;
+
+        for( i = 0u ; i < (qIndex_t)Q_NOTIFICATION_TOPICS ; i++ ){
+            if( 0uL != ( Topics & QTOPIC( i ) ) ){
+                qOS_Notification_Unlink( Task, i ); /*a node already in the list must not be linked twice*/
+                Task->qPrivate.TopicNext[ i ] = kernel.TopicSubscribers[ i ]; /*link the task at the front of the topic list*/
+                kernel.TopicSubscribers[ i ] = Task;
+                Task->qPrivate.Topics |= QTOPIC( i );
+            }
+        }
+        RetValue = qTrue;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qOS_Notification_Unsubscribe( qTask_t * const Task, const qTopic_t Topics )
+
+Unsubscribe a task from one or more notification topics.
+
+Note : Should not be called from interrupts.
+
+Parameters:
+
+    - Task : A pointer to the task node.
+    - Topics : The topic mask. Use QTOPIC(n) to build it.
+
+Return value:
+
+    qTrue on success. qFalse if the task was not subscribed to any of the
+    <Topics>.
+*/
+qBool_t qOS_Notification_Unsubscribe( qTask_t * const Task, const qTopic_t Topics ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Task ){
+        qIndex_t i;
+
+        for( i = 0u ; i < (qIndex_t)Q_NOTIFICATION_TOPICS ; i++ ){
+            if( 0uL != ( Topics & Task->qPrivate.Topics & QTOPIC( i ) ) ){
+                qOS_Notification_Unlink( Task, i );
+                RetValue = qTrue;
+            }
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+static void qOS_Notification_Unlink( qTask_t * const Task, const qIndex_t Topic ){
+    qTask_t **Link = &kernel.TopicSubscribers[ Topic ];
+
+    while( NULL != *Link ){
+        if( Task == *Link ){
+            /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+            *Link = (qTask_t*)Task->qPrivate.TopicNext[ Topic ]; /* MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed */
+            /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+            break;
+        }
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        Link = (qTask_t**)&(*Link)->qPrivate.TopicNext[ Topic ]; /* MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed */
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+    }
+    Task->qPrivate.TopicNext[ Topic ] = NULL;
+    Task->qPrivate.Topics &= ~QTOPIC( Topic );
+}
+/*============================================================================*/
+/*qBool_t qOS_Notification_SpreadTopics( const qTopic_t Topics, void *eventdata, const qTask_NotifyMode_t mode )
+
+Spread a notification only among the tasks subscribed to any of the <Topics>.
+A task subscribed to several of the <Topics> is notified once. The cost of the
+operation depends on the number of subscribers, not on the number of tasks.
+Note: Operation will be performed in the next scheduling cycle. 
+
+Parameters:
+
+    - Topics : The topic mask. Use QTOPIC(n) to build it.
+    - eventdata : Specific event user-data.
+    - mode : the method used to spread the event:
+              qTask_NotifySimple or qTask_NotifyQueued.
+
+Return value:
+
+    qTrue if success. qFalse if any other spread operation is in progress.
+*/
+qBool_t qOS_Notification_SpreadTopics( const qTopic_t Topics, void *eventdata, const qTask_NotifyMode_t mode ){
+    qBool_t RetValue = qFalse;
+
+    if( 0uL != Topics ){
+        qCritical_Enter();
+        if( qTask_NotifyNULL ==  kernel.NotificationSpreadRequest.mode ){ 
+            if( ( qTask_NotifySimple == mode ) || ( qTask_NotifyQueued == mode ) ){
+                kernel.NotificationSpreadRequest.mode = mode;
+                kernel.NotificationSpreadRequest.eventdata = eventdata;
+                kernel.NotificationSpreadRequest.topics = Topics;
+                RetValue = qTrue;
+            }
+        }
+        qCritical_Exit();
+    }
+    return RetValue;
+}
+/*============================================================================*/
+static void qOS_Notification_DeliverTopics( const qNotificationSpreader_t * const Spread ){
+    qIndex_t i;
+
+    for( i = 0u ; i < (qIndex_t)Q_NOTIFICATION_TOPICS ; i++ ){
+        if( 0uL != ( Spread->topics & QTOPIC( i ) ) ){
+            qTask_t *Subscriber = kernel.TopicSubscribers[ i ];
+
+            while( NULL != Subscriber ){
+                qTopic_t Common = Subscriber->qPrivate.Topics & Spread->topics;
+
+                if( QTOPIC( i ) == ( Common & ( ~Common + 1uL ) ) ){ /*only the lowest common topic delivers, so the subscriber gets notified once*/
+                    if( qTask_NotifySimple == Spread->mode ){
+                        (void)qTask_Notification_Send( Subscriber, Spread->eventdata );
+                    }
+                    else{
+                        (void)qTask_Notification_Queue( Subscriber, Spread->eventdata );
+                    }
+                }
+                /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+                Subscriber = (qTask_t*)Subscriber->qPrivate.TopicNext[ i ]; /* MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed */
+                /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+            }
+        }
+    }
+}
+#endif
 /*============================================================================*/
 #if ( Q_PRIO_QUEUE_SIZE > 0 )  
 static void qOS_PriorityQueue_CleanUp( const qTask_t * task ){
@@ -247,6 +632,7 @@ qBool_t qOS_PriorityQueue_Insert( qTask_t * const Task, void *Data ){
         qBase_t QueueMaxIndex, CurrentQueueIndex;
 
         QueueMaxIndex = Q_PRIO_QUEUE_SIZE - 1; /*to avoid side effects */
+        qCritical_Enter(); /*the index check and the insertion must be performed as a single operation*/
         CurrentQueueIndex = kernel.QueueIndex; /*to avoid side effects */
         if( ( NULL != Task )  && ( CurrentQueueIndex < QueueMaxIndex) ) {/*check if data can be queued*/
             qQueueStack_t tmp;
@@ -258,6 +644,7 @@ qBool_t qOS_PriorityQueue_Insert( qTask_t * const Task, void *Data ){
             /*cstat +CERT-INT32-C_a*/
             RetValue = qTrue;
         }
+        qCritical_Exit();
         return RetValue;
     #else
         Q_UNUSED( Task );
@@ -337,8 +724,9 @@ Parameters:
     - CallbackFcn : A pointer to a void callback method with a qEvent_t parameter 
                  as input argument.
     - Priority : Task priority Value. [0(min) - Q_PRIORITY_LEVELS(max)]
-    - Time : Execution interval defined in seconds (floating-point format). 
-               For immediate execution (tValue = qTimeImmediate).
+    - Time : Execution interval defined in seconds. Build it with 
+               <qTime_Seconds> (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is 
+               enabled). For immediate execution (tValue = qTimeImmediate).
     - nExecutions : Number of task executions (Integer value). For indefinite 
                execution (nExecutions = qPeriodic or qIndefinite). Tasks do not 
                remember the number of iteration set initially. After the 
@@ -391,6 +779,33 @@ qBool_t qOS_Add_Task( qTask_t * const Task, qTaskFcn_t CallbackFcn, qPriority_t
         #if ( Q_PRESERVE_TASK_ENTRY_ORDER == 1 )
             Task->qPrivate.Entry = kernel.TaskEntries++;
         #endif
+        #if ( QTASK_DEADLINES == 1 )
+            Task->qPrivate.Deadline = (qClock_t)0uL;
+            Task->qPrivate.AbsDeadline = (qClock_t)0uL;
+            Task->qPrivate.DeadlineMisses = 0uL;
+            qOS_Set_TaskFlags( Task, QTASK_BIT_FIXED_RATE | QTASK_BIT_SKIP_LATE, qFalse ); /*fixed-delay by default*/
+        #endif
+        #if ( Q_COROUTINE_WAITS == 1 )
+            #if ( Q_QUEUES == 1 )
+                Task->qPrivate.WaitQueue = NULL;
+            #endif
+            Task->qPrivate.WaitTimer = NULL;
+            Task->qPrivate.WaitFlags = 0uL;
+            qOS_Set_TaskFlags( Task, QTASK_BIT_CR_WAIT | QTASK_BIT_CR_WAIT_ALL, qFalse );
+        #endif
+        #if ( Q_NOTIFICATION_TOPICS > 0 )
+            {
+                qIndex_t i;
+
+                for( i = 0u ; i < (qIndex_t)Q_NOTIFICATION_TOPICS ; i++ ){
+                    qOS_Notification_Unlink( Task, i ); /*the task node could still be linked if it is being re-added*/
+                }
+            }
+            Task->qPrivate.Topics = 0uL; /*the task is not subscribed to any topic*/
+        #endif
+        #if ( Q_TASK_MAILBOX == 1 )
+            Task->qPrivate.Mailbox = NULL;
+        #endif
         RetValue = qList_Insert( WaitingList, Task, qList_AtBack ); 
     }
     return RetValue;  
@@ -435,8 +850,9 @@ passed as input argument inside every state.
 Parameters:
     - Task : A pointer to the task node.
     - Priority : Task priority Value. [0(min) - Q_PRIORITY_LEVELS(max)]
-    - Time : Execution interval defined in seconds (floating-point format). 
-               For immediate execution (tValue = qTimeImmediate).
+    - Time : Execution interval defined in seconds. Build it with 
+               <qTime_Seconds> (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is 
+               enabled). For immediate execution (tValue = qTimeImmediate).
     - StateMachine: A pointer to the Finite State-Machine (FSM) object
     - InitState : The first state to be performed. This argument is a pointer 
                   to a callback function, returning qSM_Status_t and with a 
@@ -599,6 +1015,52 @@ static qTrigger_t qOS_AttachedQueue_CheckEvents( const qTask_t * const Task ){
     return RetValue;
 }
 #endif
+#if ( Q_COROUTINE_WAITS == 1 )
+/*============================================================================*/
+static qTrigger_t qOS_CoroutineWait_CheckEvents( qTask_t * const Task ){
+    qTrigger_t RetValue = qTriggerNULL;
+
+    #if ( Q_QUEUES == 1 )
+    if( NULL != Task->qPrivate.WaitQueue ){
+        qBool_t Available;
+
+        if( qOS_Get_TaskFlag( Task, QTASK_BIT_CR_WAIT_ALL ) ){ /*on queue waits, this bit selects a wait for room*/
+            Available = ( qFalse == qQueue_IsFull( Task->qPrivate.WaitQueue ) )? qTrue : qFalse;
+        }
+        else{
+            Available = ( qFalse == qQueue_IsEmpty( Task->qPrivate.WaitQueue ) )? qTrue : qFalse;
+        }
+        if( qTrue == Available ){ /*the coroutine performs the transfer by itself*/
+            RetValue = byWaitRelease;
+        }
+    }
+    else
+    #endif
+    if( 0uL != Task->qPrivate.WaitFlags ){
+        qTask_Flag_t Current = Task->qPrivate.Flags & Task->qPrivate.WaitFlags;
+
+        if( qOS_Get_TaskFlag( Task, QTASK_BIT_CR_WAIT_ALL ) ){
+            RetValue = ( Current == Task->qPrivate.WaitFlags )? byEventFlags : qTriggerNULL;
+        }
+        else{
+            RetValue = ( 0uL != Current )? byEventFlags : qTriggerNULL;
+        }
+    }
+    else if( Task->qPrivate.Notification > (qNotifier_t)0 ){ /*the dispatcher consumes the notification as usual*/
+        RetValue = byNotificationSimple;
+    }
+    else{
+        /*this case does not need to be handled*/
+    }
+    if( ( qTriggerNULL == RetValue ) && qSTimer_Expired( Task->qPrivate.WaitTimer ) ){
+        RetValue = byWaitRelease;
+    }
+    if( qTriggerNULL != RetValue ){ /*the awaited object changed, unblock the task*/
+        qOS_Set_TaskFlags( Task, QTASK_BIT_CR_WAIT | QTASK_BIT_CR_WAIT_ALL, qFalse );
+    }
+    return RetValue;
+}
+#endif
 /*============================================================================*/
 #if ( Q_ALLOW_SCHEDULER_RELEASE == 1 )
 static void qOS_TriggerReleaseSchedEvent( void ){
@@ -624,9 +1086,15 @@ pool has been defined.
 */
 void qOS_Run( void ){
     do{           
+        QKERNEL_SET_ACTIVITY( QKERNEL_ACTIVITY_POLL );
         if( qList_ForEach( WaitingList, qOS_CheckIfReady, NULL, QLIST_FORWARD, NULL ) ){ /*check for ready tasks in the waiting-list*/
             qIndex_t xPriorityListIndex = (qIndex_t)Q_PRIORITY_LEVELS - (qIndex_t)1;
             qList_t *xList;
+
+            #if ( Q_CPU_LOAD_MONITOR == 1 )
+                QKERNEL_SET_ACTIVITY( QKERNEL_ACTIVITY_KERNEL );
+                qOS_CPULoad_ResolvePoll( qTrue );
+            #endif
             do{ /*loop every ready-list in descending priority order*/
                 xList = &ReadyList[ xPriorityListIndex ]; /*get the target ready-list*/
                 if( xList->size > (size_t)0 ){ /*check for a non-empty target list */
@@ -635,11 +1103,16 @@ void qOS_Run( void ){
             }while( (qIndex_t)0 != xPriorityListIndex-- ); /*move to the next ready-list*/
         }
         else{ /*no task in the scheme is ready*/
+            #if ( Q_CPU_LOAD_MONITOR == 1 )
+                QKERNEL_SET_ACTIVITY( QKERNEL_ACTIVITY_IDLE );
+                qOS_CPULoad_ResolvePoll( qFalse );
+            #endif
             if( NULL != kernel.IDLECallback ){ /*check if the idle-task is available*/
                 _qList_ForEachHandle_t qOS_BuiltIn_IdleTask = { NULL, NULL, qList_WalkThrough };
                 (void)qOS_Dispatch( &qOS_BuiltIn_IdleTask ); /*special call to dispatch idle-task already hardcoded in the kernel*/
             }
         }
+        QKERNEL_SET_ACTIVITY( QKERNEL_ACTIVITY_KERNEL );
         if( SuspendedList->size > (size_t)0 ){  /*check for a non-empty suspended-list*/
             (void)qList_Move( WaitingList, SuspendedList, qList_AtBack ); /*move the remaining suspended tasks to the waiting-list*/
             #if ( Q_PRESERVE_TASK_ENTRY_ORDER == 1)
@@ -670,11 +1143,30 @@ static qBool_t qOS_CheckIfReady( qList_ForEachHandle_t h ){
     #if ( Q_QUEUES == 1 )
         qTrigger_t trg;
     #endif
+    #if ( QTASK_DEADLINES == 1 )
+        qClock_t xRelease = qClock_GetTick(); /*asynchronous events are released right now*/
+    #endif
     static qBool_t xReady = qFalse;
+    #if ( Q_NOTIFICATION_SPREADER == 1 )
+        static qNotificationSpreader_t xSpread; /*the spread request served in this walk (zero-initialized : qTask_NotifyNULL)*/
+    #endif
     qBool_t RetValue = qFalse;
 
     if( QLIST_WALKINIT == h->stage ){
         xReady = qFalse;
+        #if ( Q_NOTIFICATION_SPREADER == 1 )
+            qCritical_Enter();
+            xSpread = kernel.NotificationSpreadRequest; /*take the pending request, so a new one can be posted from now on*/
+            kernel.NotificationSpreadRequest.mode = qTask_NotifyNULL;
+            kernel.NotificationSpreadRequest.eventdata = NULL;
+            qCritical_Exit();
+            #if ( Q_NOTIFICATION_TOPICS > 0 )
+                if( ( qTask_NotifyNULL != xSpread.mode ) && ( 0uL != xSpread.topics ) ){
+                    qOS_Notification_DeliverTopics( &xSpread ); /*only the subscribers are notified*/
+                    xSpread.mode = qTask_NotifyNULL;
+                }
+            #endif
+        #endif
         #if ( Q_PRIO_QUEUE_SIZE > 0 )  
             xTask = qOS_PriorityQueue_Get(); /*try to extract a task from the front of the priority queue*/
             if( NULL != xTask ){  /*if we got a task from the priority queue,*/
@@ -688,14 +1180,13 @@ static qBool_t qOS_CheckIfReady( qList_ForEachHandle_t h ){
         xTask = (qTask_t*)h->node; /* MISRAC2012-Rule-11.5,CERT-EXP36-C_b deviation allowed */
         /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
         #if ( Q_NOTIFICATION_SPREADER == 1 )
-            if( qTask_NotifyNULL != kernel.NotificationSpreadRequest.mode ){
-                if( qTask_NotifySimple == kernel.NotificationSpreadRequest.mode ){
-                    (void)qTask_Notification_Send( xTask, kernel.NotificationSpreadRequest.eventdata );
+            if( qTask_NotifyNULL != xSpread.mode ){
+                if( qTask_NotifySimple == xSpread.mode ){
+                    (void)qTask_Notification_Send( xTask, xSpread.eventdata );
                 }
                 else{
-                    (void)qTask_Notification_Queue( xTask, kernel.NotificationSpreadRequest.eventdata );
+                    (void)qTask_Notification_Queue( xTask, xSpread.eventdata );
                 }
-                RetValue = qTrue;
             }
         #endif
         if( qOS_Get_TaskFlag( xTask, QTASK_BIT_SHUTDOWN) ){
@@ -705,8 +1196,19 @@ static qBool_t qOS_CheckIfReady( qList_ForEachHandle_t h ){
             }
             else
             #endif 
+            #if ( Q_COROUTINE_WAITS == 1 )
+            if( qOS_Get_TaskFlag( xTask, QTASK_BIT_CR_WAIT ) ){ /*a blocked coroutine only gets ready when the awaited object changes*/
+                xTask->qPrivate.Trigger = qOS_CoroutineWait_CheckEvents( xTask );
+                xReady = ( qTriggerNULL != xTask->qPrivate.Trigger )? qTrue : xReady;
+            }
+            else
+            #endif
             if( qOS_TaskDeadLineReached( xTask ) ){ /*nested check for timed task, check the first requirement(the task must be enabled)*/
-                (void)qSTimer_Reload( &xTask->qPrivate.timer );
+                #if ( QTASK_DEADLINES == 1 )
+                    xRelease = qOS_Task_Reschedule( xTask );
+                #else
+                    (void)qSTimer_Reload( &xTask->qPrivate.timer );
+                #endif
                 xTask->qPrivate.Trigger = byTimeElapsed;      
                 xReady = qTrue;            
             }
@@ -720,6 +1222,12 @@ static qBool_t qOS_CheckIfReady( qList_ForEachHandle_t h ){
                 xTask->qPrivate.Trigger = byNotificationSimple;  
                 xReady = qTrue;            
             }
+            #if ( Q_TASK_MAILBOX == 1 )
+            else if( qTask_Mailbox_Count( xTask ) > 0u ){ /*task with pending mails?*/
+                xTask->qPrivate.Trigger = byNotificationMailbox;
+                xReady = qTrue;
+            }
+            #endif
             #if ( Q_TASK_EVENT_FLAGS == 1 )
             else if( 0uL != (QTASK_EVENTFLAGS_RMASK & xTask->qPrivate.Flags ) ){ /*task with enabled eventflags?*/
                 xTask->qPrivate.Trigger = byEventFlags;          
@@ -738,19 +1246,37 @@ static qBool_t qOS_CheckIfReady( qList_ForEachHandle_t h ){
                 qOS_PriorityQueue_CleanUp( xTask ); /*clean any entry of this task from the priority queue */
                 qCritical_Exit();
             #endif
+            #if ( Q_NOTIFICATION_TOPICS > 0 )
+                (void)qOS_Notification_Unsubscribe( xTask, xTask->qPrivate.Topics ); /*drop the task from the topic lists*/
+            #endif
             qOS_Set_TaskFlags( xTask, QTASK_BIT_REMOVE_REQUEST, qFalse );  /*clear the removal request*/
         }
         else{
             qList_t *xList;
-            xList = ( qTriggerNULL != xTask->qPrivate.Trigger )? &ReadyList[ xTask->qPrivate.Priority ] : SuspendedList;
-            (void)qList_Insert( xList, xTask, QLIST_ATBACK );
+            qList_Position_t xPosition = QLIST_ATBACK;
+
+            if( qTriggerNULL != xTask->qPrivate.Trigger ){
+                #if ( QTASK_DEADLINES == 1 )
+                    xTask->qPrivate.AbsDeadline = xRelease + qOS_Task_RelativeDeadline( xTask );
+                #endif
+                #if ( Q_SCHEDULER_EDF == 1 )
+                    xList = ReadyList; /*a single ready-list ordered by absolute deadline is used*/
+                    xPosition = qOS_EDF_GetPosition( xList, xTask );
+                #else
+                    xList = &ReadyList[ xTask->qPrivate.Priority ];
+                #endif
+            }
+            else{
+                xList = SuspendedList;
+            }
+            (void)qList_Insert( xList, xTask, xPosition );
         }
     }
     else if( QLIST_WALKEND == h->stage ){ 
         #if ( Q_NOTIFICATION_SPREADER == 1 )
             /*spread operation done, clean-up*/
-            kernel.NotificationSpreadRequest.mode = qTask_NotifyNULL;
-            kernel.NotificationSpreadRequest.eventdata = NULL;
+            xSpread.mode = qTask_NotifyNULL;
+            xSpread.eventdata = NULL;
         #endif
         RetValue = xReady; 
     }
@@ -781,9 +1307,17 @@ static qTrigger_t qOS_Dispatch_xTask_FillEventInfo( qTask_t *Task ){
             kernel.EventInfo.StartDelay = qClock_GetTick() - Task->qPrivate.timer.Start;
             break;
         case byNotificationSimple:
+            qCritical_Enter(); /*the notifier can be updated from an interrupt or another thread*/
             kernel.EventInfo.EventData = Task->qPrivate.AsyncData; /*Transfer async-data to the eventinfo structure*/
             --Task->qPrivate.Notification; /* = qFalse */ /*Clear the async flag*/            
+            qCritical_Exit();
             break;
+        #if ( Q_TASK_MAILBOX == 1 )
+            case byNotificationMailbox:
+                (void)qTask_Mailbox_Receive( Task, &Task->qPrivate.Mailbox->qPrivate.Current, 1u ); /*extract the front mail*/
+                kernel.EventInfo.EventData = (void*)&Task->qPrivate.Mailbox->qPrivate.Current;
+                break;
+        #endif
         #if ( Q_QUEUES == 1 )    
             case byQueueReceiver:
                 kernel.EventInfo.EventData = qQueue_Peek( Task->qPrivate.Queue ); /*the EventData will point to the queue front-data*/
@@ -824,6 +1358,7 @@ static qBool_t qOS_Dispatch( qList_ForEachHandle_t h ){
             /*cstat +MISRAC2012-Rule-11.5 +MISRAC2012-Rule-14.3_a +MISRAC2012-Rule-14.3_b +CERT-EXP36-C_b*/   
             Event = qOS_Dispatch_xTask_FillEventInfo( Task ); /*#!OK : false-positive can be reported here*/
             TaskActivities = Task->qPrivate.Callback; /*#!OK: false-positive can be reported here*/
+            QKERNEL_SET_ACTIVITY( QKERNEL_ACTIVITY_TASK );
             #if ( Q_FSM == 1)
                 if ( ( NULL != Task->qPrivate.StateMachine ) && ( qOS_DummyTask_Callback == Task->qPrivate.Callback ) ){
                     (void)qStateMachine_Run( Task->qPrivate.StateMachine, (void*)&kernel.EventInfo );  /*If the task has a FSM attached, just run it*/  
@@ -839,7 +1374,11 @@ static qBool_t qOS_Dispatch( qList_ForEachHandle_t h ){
                     TaskActivities( &kernel.EventInfo ); /*else, just launch the callback function*/ 
                 }     
             #endif
+            QKERNEL_SET_ACTIVITY( QKERNEL_ACTIVITY_KERNEL );
             kernel.CurrentRunningTask = NULL;
+            #if ( QTASK_DEADLINES == 1 )
+                qOS_Task_CheckDeadline( Task );
+            #endif
             (void)qList_Remove( xList, NULL, qList_AtFront ); /*remove the task from the ready-list*/
             (void)qList_Insert( WaitingList, Task, QLIST_ATBACK );  /*and insert the task back to the waiting-list*/
             #if ( Q_QUEUES == 1) 
@@ -870,6 +1409,80 @@ static qBool_t qOS_Dispatch( qList_ForEachHandle_t h ){
     return qFalse;
 }
 /*============================================================================*/
+#if ( QTASK_DEADLINES == 1 )
+static qClock_t qOS_Task_RelativeDeadline( const qTask_t * const Task ){
+    qClock_t RetValue = Task->qPrivate.Deadline;
+
+    if( 0uL == RetValue ){
+        RetValue = Task->qPrivate.timer.TV; /*implicit deadline : the task period*/
+    }
+    return RetValue;
+}
+/*============================================================================*/
+static qClock_t qOS_Task_Reschedule( qTask_t * const Task ){
+    qSTimer_t * const xTimer = &Task->qPrivate.timer;
+    qClock_t Release = qClock_GetTick();
+
+    if( xTimer->TV > 0uL ){
+        if( qOS_Get_TaskFlag( Task, QTASK_BIT_FIXED_RATE ) ){
+            if( qOS_Get_TaskFlag( Task, QTASK_BIT_SKIP_LATE ) ){
+                Release = xTimer->Start + ( xTimer->TV*( ( Release - xTimer->Start )/xTimer->TV ) ); /*the latest nominal release, lost ones are skipped*/
+            }
+            else{
+                Release = xTimer->Start + xTimer->TV; /*the nominal release, lost ones will be caught up*/
+            }
+            xTimer->Start = Release; /*rearm from the nominal release, the schedule does not drift*/
+        }
+        else{
+            Release = xTimer->Start + xTimer->TV; /*the time when the period expired*/
+            (void)qSTimer_Reload( xTimer );
+        }
+    }
+    else{
+        (void)qSTimer_Reload( xTimer );
+    }
+    return Release;
+}
+/*============================================================================*/
+static void qOS_Task_CheckDeadline( qTask_t * const Task ){
+    if( qOS_Task_RelativeDeadline( Task ) > 0uL ){
+        qClock_t Lateness = qClock_GetTick() - Task->qPrivate.AbsDeadline;
+
+        if( (qINT32_t)Lateness > 0 ){ /*the task finished after its absolute deadline*/
+            if( Task->qPrivate.DeadlineMisses < 0xFFFFFFFFuL ){
+                ++Task->qPrivate.DeadlineMisses;
+            }
+            if( NULL != kernel.DeadlineMissCallback ){
+                qTaskDeadlineMissFcn_t Callback = kernel.DeadlineMissCallback;
+                Callback( Task, Lateness );
+            }
+        }
+    }
+}
+#endif /* #if ( QTASK_DEADLINES == 1 ) */
+/*============================================================================*/
+#if ( Q_SCHEDULER_EDF == 1 )
+static qList_Position_t qOS_EDF_GetPosition( const qList_t * const xList, const qTask_t * const Task ){
+    qList_Position_t RetValue = QLIST_ATBACK;
+
+    if( qOS_Task_RelativeDeadline( Task ) > 0uL ){ /*tasks without deadline are kept at the back*/
+        qList_Node_t *iNode;
+        qList_Position_t iPos = QLIST_ATFRONT;
+        
+        for( iNode = xList->head ; NULL != iNode ; iNode = iNode->next ){
+            const qTask_t *iTask = (const qTask_t*)iNode; /*MISRAC2012-Rule-11.3 allowed*/
+            /*stop at the first task without deadline or with a later one (equal deadlines keep the FIFO order)*/
+            if( ( 0uL == qOS_Task_RelativeDeadline( iTask ) ) || ( (qINT32_t)( Task->qPrivate.AbsDeadline - iTask->qPrivate.AbsDeadline ) < 0 ) ){
+                RetValue = iPos;
+                break;
+            }
+            ++iPos;
+        }
+    }
+    return RetValue;
+}
+#endif /* #if ( Q_SCHEDULER_EDF == 1 ) */
+/*============================================================================*/
 static qBool_t qOS_TaskDeadLineReached( qTask_t * const Task ){
     qBool_t RetValue = qFalse;
     
@@ -922,10 +1535,12 @@ qBool_t qOS_Get_TaskFlag( const qTask_t * const Task, qUINT32_t flag ){
 }
 /*========================== Shared Private Method ===========================*/
 void qOS_Set_TaskFlags( qTask_t * const Task, qUINT32_t flags, qBool_t value ){
+    qCritical_Enter(); /*core-bits and event-flags share the same word, the RMW must be atomic*/
     if( qTrue == value ){
         Task->qPrivate.Flags |= flags; /*Set bits*/
     }
     else{
         Task->qPrivate.Flags &= ~flags; /*Clear bits*/
     }
+    qCritical_Exit();
 }
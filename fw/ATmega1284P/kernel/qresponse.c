@@ -2,6 +2,12 @@
 
 #if ( Q_RESPONSE_HANDLER == 1 )
 
+#define QRESPONSE_MULTI_CLASSMAP_SIZE   ( 128u )
+
+static size_t qResponse_Fallback( const char *Pattern, size_t Matched, const char rxchar );
+static qResponse_Capture_t* qResponse_Multi_FindCapture( const qResponse_Multi_t * const obj, const qBase_t Pattern );
+static qBool_t qResponse_Multi_Complete( qResponse_Multi_t * const obj, qResponse_Capture_t * const Capture );
+
 /*============================================================================*/
 /*void qResponse_Setup( qResponse_t * const obj, char *xLocBuff, size_t nMax)
 
@@ -131,10 +137,437 @@ qBool_t qResponse_ISRHandler( qResponse_t * const obj, const char rxchar ){
                     RetValue = obj->qPrivate.ResponseReceived;
                 }
             }
+            else{ /*mismatch : keep the longest partial match that is still valid (i.e "OOK" must match "OK")*/
+                obj->qPrivate.MatchedCount = qResponse_Fallback( obj->qPrivate.Pattern2Match, obj->qPrivate.MatchedCount, rxchar );
+            }
         }    
     }
     return RetValue;
 }
 /*============================================================================*/
+static size_t qResponse_Fallback( const char *Pattern, size_t Matched, const char rxchar ){
+    size_t RetValue = 0u;
+    size_t k = Matched;
+
+    /*the received chars are Pattern[0..Matched-1] + rxchar, find the longest suffix of them that is also a pattern prefix*/
+    while( k > 0u ){
+        --k;
+        if( ( rxchar == Pattern[ k ] ) && ( 0 == memcmp( Pattern, &Pattern[ Matched - k ], k ) ) ){
+            RetValue = k + 1u;
+            break;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qResponse_Multi_Setup( qResponse_Multi_t * const obj, const char * const *Patterns, const size_t Count, qUINT8_t *Workspace, const size_t WorkspaceSize )
+
+Initialize a multi-pattern response handler. All the patterns (i.e "OK", "ERROR",
+"+CME ERROR", URCs) are watched at the same time by a single automaton
+(Aho-Corasick) that is fully precomputed here, so the ISR handler spends a
+single table lookup for every received byte. When two patterns end at the same
+byte (i.e "ERROR" and "+CME ERROR") the longest one is reported.
+
+Parameters:
+
+    - obj : A pointer to the Multi-Response Handler object
+    - Patterns : An array of pointers to the patterns (null-terminated ASCII
+                 strings, up to QRESPONSE_MULTI_MAX_PATTERNS).
+    - Count : The number of patterns.
+    - Workspace : A block of memory to hold the automaton. It must remain
+                  valid while the handler is in use.
+    - WorkspaceSize : The size of <Workspace>. Use the macro
+                      QRESPONSE_MULTI_WORKSPACE( nChars, nClasses ) where
+                      nChars is the sum of the pattern lengths(less than 255)
+                      and nClasses the number of different chars used by them.
+
+Return value:
+
+    qTrue on success, otherwise returns qFalse
+*/
+qBool_t qResponse_Multi_Setup( qResponse_Multi_t * const obj, const char * const *Patterns, const size_t Count, qUINT8_t *Workspace, const size_t WorkspaceSize ){
+    qBool_t RetValue = qFalse;
+
+    if( ( NULL != obj ) && ( NULL != Patterns ) && ( NULL != Workspace ) && ( Count > 0u ) && ( Count <= QRESPONSE_MULTI_MAX_PATTERNS ) ){
+        qUINT8_t *ClassMap = Workspace;
+        size_t Chars = 0u, MaxLength = 0u, Classes = 1u, i, j;
+        qBool_t Valid = qTrue;
+
+        (void)memset( ClassMap, 0, QRESPONSE_MULTI_CLASSMAP_SIZE );
+        for( i = 0u ; ( i < Count ) && ( qTrue == Valid ) ; ++i ){ /*assign an input class to every char used*/
+            size_t Length = ( NULL != Patterns[ i ] )? strlen( Patterns[ i ] ) : 0u;
+
+            Valid = ( Length > 0u )? qTrue : qFalse;
+            for( j = 0u ; j < Length ; ++j ){
+                qUINT8_t c = (qUINT8_t)Patterns[ i ][ j ];
+
+                if( c >= QRESPONSE_MULTI_CLASSMAP_SIZE ){
+                    Valid = qFalse;
+                }
+                else if( 0u == ClassMap[ c ] ){
+                    ClassMap[ c ] = (qUINT8_t)Classes++;
+                }
+                else{
+                    /*nothing to do, class already assigned*/
+                }
+            }
+            Chars += Length;
+            MaxLength = ( Length > MaxLength )? Length : MaxLength;
+        }
+
+        if( ( qTrue == Valid ) && ( Chars < 255u ) && ( QRESPONSE_MULTI_WORKSPACE( Chars, Classes - 1u ) <= WorkspaceSize ) ){
+            const size_t States = Chars + 1u; /*upper bound, the shared prefixes use less*/
+            qUINT8_t *Accept = &Workspace[ QRESPONSE_MULTI_CLASSMAP_SIZE ];
+            qUINT8_t *Fail = &Accept[ States ];
+            qUINT8_t *Delta = &Fail[ States ];
+            size_t Depth, s, k, Used = 1u;
+
+            (void)memset( Accept, 0, States*( Classes + 2u ) );
+            /*build the trie level by level, so the states get numbered in breadth-first order*/
+            for( Depth = 0u ; Depth < MaxLength ; ++Depth ){
+                for( i = 0u ; i < Count ; ++i ){
+                    const char *p = Patterns[ i ];
+                    size_t Length = strlen( p );
+
+                    if( Length > Depth ){
+                        qUINT8_t *Next;
+                        size_t State = 0u;
+
+                        for( j = 0u ; j < Depth ; ++j ){
+                            State = Delta[ ( State*Classes ) + ClassMap[ (qUINT8_t)p[ j ] ] ];
+                        }
+                        Next = &Delta[ ( State*Classes ) + ClassMap[ (qUINT8_t)p[ Depth ] ] ];
+                        if( 0u == *Next ){
+                            *Next = (qUINT8_t)Used++;
+                        }
+                        if( ( ( Depth + 1u ) == Length ) && ( 0u == Accept[ *Next ] ) ){
+                            Accept[ *Next ] = (qUINT8_t)( i + 1u );
+                        }
+                    }
+                }
+            }
+            /*breadth-first pass : set the failure links and turn the trie into a complete automaton*/
+            for( s = 0u ; s < Used ; ++s ){
+                qUINT8_t *Row = &Delta[ s*Classes ];
+                const qUINT8_t *FailRow = &Delta[ (size_t)Fail[ s ]*Classes ];
+
+                for( k = 0u ; k < Classes ; ++k ){
+                    if( 0u != Row[ k ] ){ /*trie edge*/
+                        qUINT8_t Child = Row[ k ];
+
+                        Fail[ Child ] = ( 0u == s )? 0u : FailRow[ k ];
+                        if( 0u == Accept[ Child ] ){
+                            Accept[ Child ] = Accept[ Fail[ Child ] ]; /*a shorter pattern ends here*/
+                        }
+                    }
+                    else if( s > 0u ){
+                        Row[ k ] = FailRow[ k ];
+                    }
+                    else{
+                        /*nothing to do, the root keeps its self-loop*/
+                    }
+                }
+            }
+            obj->qPrivate.Captures = NULL;
+            obj->qPrivate.ClassMap = ClassMap;
+            obj->qPrivate.Accept = Accept;
+            obj->qPrivate.Delta = Delta;
+            obj->qPrivate.Classes = Classes;
+            qResponse_Multi_Reset( obj );
+            RetValue = qTrue;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*void qResponse_Multi_Reset( qResponse_Multi_t * const obj )
+
+Reset the Multi-Response Handler, discarding the pending matches.
+
+Parameters:
+
+    - obj : A pointer to the Multi-Response Handler object
+
+*/
+void qResponse_Multi_Reset( qResponse_Multi_t * const obj ){
+    if( NULL != obj ){
+        qCritical_Enter();
+        obj->qPrivate.State = 0u;
+        obj->qPrivate.Matched = 0uL;
+        obj->qPrivate.Capturing = NULL;
+        qCritical_Exit();
+    }
+}
+/*============================================================================*/
+/*qBase_t qResponse_Multi_Received( qResponse_Multi_t * const obj )
+
+Non-Blocking check for any of the patterns. A single call reports which pattern
+was received, so there is no need to poll every pattern. The reported match is
+cleared.
+Patterns with a capture that has a callback (i.e URCs) are not reported: their
+callbacks are invoked from here (the caller context) and the capture gets
+released after the callback returns.
+
+Parameters:
+
+    - obj : A pointer to the Multi-Response Handler object
+
+Return value:
+
+    The index of the received pattern inside the array given to
+    <qResponse_Multi_Setup> (the lowest index if several are pending),
+    otherwise returns QRESPONSE_MULTI_NONE
+*/
+qBase_t qResponse_Multi_Received( qResponse_Multi_t * const obj ){
+    qBase_t RetValue = QRESPONSE_MULTI_NONE;
+
+    if( NULL != obj ){
+        qBool_t Dispatched;
+
+        do{
+            qUINT32_t Matched;
+            qBase_t Pattern = QRESPONSE_MULTI_NONE;
+
+            Dispatched = qFalse;
+            qCritical_Enter();
+            Matched = obj->qPrivate.Matched;
+            if( 0uL != Matched ){
+                Pattern = 0;
+                while( 0uL == ( Matched & 1uL ) ){
+                    Matched >>= 1u;
+                    ++Pattern;
+                }
+                obj->qPrivate.Matched &= ~( (qUINT32_t)1uL << (qUINT32_t)Pattern );
+            }
+            qCritical_Exit();
+            if( QRESPONSE_MULTI_NONE != Pattern ){
+                qResponse_Capture_t *Capture = qResponse_Multi_FindCapture( obj, Pattern );
+
+                if( ( NULL != Capture ) && ( NULL != Capture->qPrivate.Callback ) ){ /*route the unsolicited result*/
+                    Capture->qPrivate.Callback( Capture, Capture->qPrivate.Buffer, Capture->qPrivate.Length );
+                    qResponse_Capture_Release( Capture );
+                    Dispatched = qTrue;
+                }
+                else{
+                    RetValue = Pattern;
+                }
+            }
+        }while( qTrue == Dispatched );
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qResponse_Multi_ISRHandler( qResponse_Multi_t * const obj, const char rxchar )
+
+ISR receiver for the Multi-Response handler. Every byte costs a single
+transition of the precomputed automaton. While a capture is in progress, the
+bytes are stored directly in the capture buffer and the automaton is paused
+until the terminator arrives.
+
+Parameters:
+
+    - obj : A pointer to the Multi-Response Handler object
+    - rxchar: The byte-data from the receiver
+
+Return value:
+
+    qTrue when any of the patterns has been received, otherwise qFalse
+*/
+qBool_t qResponse_Multi_ISRHandler( qResponse_Multi_t * const obj, const char rxchar ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != obj ){
+        qResponse_Capture_t * const Capture = obj->qPrivate.Capturing;
+
+        if( NULL != Capture ){
+            if( Capture->qPrivate.Terminator == rxchar ){
+                obj->qPrivate.Capturing = NULL;
+                RetValue = qResponse_Multi_Complete( obj, Capture );
+            }
+            else if( ( Capture->qPrivate.Length + 1u ) < Capture->qPrivate.Size ){
+                Capture->qPrivate.Buffer[ Capture->qPrivate.Length++ ] = rxchar; /*MISRAC2004-17.4_b deviation allowed*/
+            }
+            else{
+                /*nothing to do, the payload gets truncated*/
+            }
+        }
+        else if( NULL != obj->qPrivate.Delta ){
+            qUINT8_t c = (qUINT8_t)rxchar;
+            size_t Class = ( c < QRESPONSE_MULTI_CLASSMAP_SIZE )? (size_t)obj->qPrivate.ClassMap[ c ] : 0u;
+            qUINT8_t State = obj->qPrivate.Delta[ ( (size_t)obj->qPrivate.State*obj->qPrivate.Classes ) + Class ];
+            qUINT8_t Pattern = obj->qPrivate.Accept[ State ];
+
+            obj->qPrivate.State = State;
+            if( 0u != Pattern ){
+                qResponse_Capture_t *Match = qResponse_Multi_FindCapture( obj, (qBase_t)Pattern - 1 );
+
+                if( NULL == Match ){
+                    obj->qPrivate.Matched |= (qUINT32_t)1uL << ( Pattern - 1u );
+                    RetValue = qTrue;
+                }
+                else if( qFalse == Match->qPrivate.Ready ){ /*an unreleased payload is never overwritten*/
+                    Match->qPrivate.Length = 0u;
+                    if( NULL != Match->qPrivate.Buffer ){
+                        obj->qPrivate.Capturing = Match; /*start the payload capture*/
+                    }
+                    else{
+                        RetValue = qResponse_Multi_Complete( obj, Match );
+                    }
+                }
+                else{
+                    /*nothing to do, the occurrence is lost*/
+                }
+            }
+        }
+        else{
+            /*nothing to do, not configured yet*/
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+static qResponse_Capture_t* qResponse_Multi_FindCapture( const qResponse_Multi_t * const obj, const qBase_t Pattern ){
+    qResponse_Capture_t *Capture;
+
+    for( Capture = obj->qPrivate.Captures ; NULL != Capture ; Capture = Capture->qPrivate.Next ){
+        if( Pattern == Capture->qPrivate.Pattern ){
+            break;
+        }
+    }
+    return Capture;
+}
+/*============================================================================*/
+static qBool_t qResponse_Multi_Complete( qResponse_Multi_t * const obj, qResponse_Capture_t * const Capture ){
+    if( NULL != Capture->qPrivate.Buffer ){
+        Capture->qPrivate.Buffer[ Capture->qPrivate.Length ] = (char)'\0'; /*MISRAC2004-17.4_b deviation allowed*/
+    }
+    Capture->qPrivate.Ready = qTrue;
+    obj->qPrivate.State = 0u; /*the automaton starts over after the payload*/
+    obj->qPrivate.Matched |= (qUINT32_t)1uL << (qUINT32_t)Capture->qPrivate.Pattern;
+    (void)qTask_Notification_Send( Capture->qPrivate.Task, Capture );
+    return qTrue;
+}
+/*============================================================================*/
+/*qBool_t qResponse_Multi_Add_Capture( qResponse_Multi_t * const obj, qResponse_Capture_t * const Capture, const qBase_t Pattern, char *Buffer, const size_t Size, const char Terminator )
+
+Attach a capture to one of the patterns of the Multi-Response handler. Once the
+pattern is matched, the following bytes are written by the ISR straight into
+<Buffer> until <Terminator> arrives (i.e "+CSQ: " captures "21,0" up to '\r').
+The match is reported only when the payload is complete, and the payload is
+kept until it gets released, later occurrences of the pattern are dropped
+meanwhile.
+
+Parameters:
+
+    - obj : A pointer to the Multi-Response Handler object
+    - Capture : A pointer to the capture object
+    - Pattern : The index of the pattern given to <qResponse_Multi_Setup>
+    - Buffer : The storage for the payload (null-terminated, truncated to
+               fit). Pass NULL to only route the pattern without payload.
+    - Size : The size of <Buffer>
+    - Terminator : The char that ends the payload (not stored)
+
+Return value:
+
+    qTrue on success, otherwise returns qFalse
+*/
+qBool_t qResponse_Multi_Add_Capture( qResponse_Multi_t * const obj, qResponse_Capture_t * const Capture, const qBase_t Pattern, char *Buffer, const size_t Size, const char Terminator ){
+    qBool_t RetValue = qFalse;
+
+    if( ( NULL != obj ) && ( NULL != Capture ) && ( Pattern >= 0 ) && ( Pattern < (qBase_t)QRESPONSE_MULTI_MAX_PATTERNS ) ){
+        if( ( NULL == Buffer ) || ( Size > 0u ) ){
+            Capture->qPrivate.Buffer = Buffer;
+            Capture->qPrivate.Size = Size;
+            Capture->qPrivate.Length = 0u;
+            Capture->qPrivate.Callback = NULL;
+            Capture->qPrivate.Task = NULL;
+            Capture->qPrivate.Pattern = Pattern;
+            Capture->qPrivate.Terminator = Terminator;
+            Capture->qPrivate.Ready = qFalse;
+            qCritical_Enter();
+            Capture->qPrivate.Next = obj->qPrivate.Captures;
+            obj->qPrivate.Captures = Capture;
+            qCritical_Exit();
+            RetValue = qTrue;
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qResponse_Capture_Set_Handler( qResponse_Capture_t * const Capture, const qResponse_CaptureFcn_t Callback, qTask_t * const Task )
+
+Set the routing of a completed capture, usually for unsolicited result codes.
+
+Parameters:
+
+    - Capture : A pointer to the capture object
+    - Callback : Invoked from <qResponse_Multi_Received> with the payload, the
+                 capture is released after it returns. The pattern is not
+                 reported to the caller in this case. Can be NULL.
+    - Task : A task that receives a simple notification from the ISR as soon
+             as the capture completes, with the capture passed through the
+             <EventData> field. Can be NULL.
+
+Return value:
+
+    qTrue on success, otherwise returns qFalse
+*/
+qBool_t qResponse_Capture_Set_Handler( qResponse_Capture_t * const Capture, const qResponse_CaptureFcn_t Callback, qTask_t * const Task ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Capture ){
+        qCritical_Enter();
+        Capture->qPrivate.Callback = Callback;
+        Capture->qPrivate.Task = Task;
+        qCritical_Exit();
+        RetValue = qTrue;
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*const char* qResponse_Capture_Payload( const qResponse_Capture_t * const Capture, size_t * const Length )
+
+Get the payload of a completed capture. The payload remains valid until
+<qResponse_Capture_Release> is called.
+
+Parameters:
+
+    - Capture : A pointer to the capture object
+    - Length : Where the payload length will be written. Can be NULL.
+
+Return value:
+
+    The null-terminated payload, or NULL if the capture is not complete
+*/
+const char* qResponse_Capture_Payload( const qResponse_Capture_t * const Capture, size_t * const Length ){
+    const char *RetValue = NULL;
+
+    if( NULL != Capture ){
+        if( qTrue == Capture->qPrivate.Ready ){
+            RetValue = Capture->qPrivate.Buffer;
+            if( NULL != Length ){
+                *Length = Capture->qPrivate.Length;
+            }
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*void qResponse_Capture_Release( qResponse_Capture_t * const Capture )
+
+Release the payload of a capture, so the next occurrence of the pattern can be
+captured.
+
+Parameters:
+
+    - Capture : A pointer to the capture object
+
+*/
+void qResponse_Capture_Release( qResponse_Capture_t * const Capture ){
+    if( NULL != Capture ){
+        Capture->qPrivate.Ready = qFalse;
+    }
+}
+/*============================================================================*/
 
 #endif /* #if ( Q_RESPONSE_HANDLER == 1 ) */
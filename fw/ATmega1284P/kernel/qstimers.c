@@ -32,7 +32,8 @@ armed immediately
 Parameters:
 
     - obj : A pointer to the STimer object.
-    - Time : The expiration time(Must be specified in seconds).
+    - Time : The expiration time in seconds. Build it with <qTime_Seconds>
+             (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is enabled).
 
     > Note 1: The OS must be running before using STimers.
     > Note 2: The expiration time should be at least, two times greater than
@@ -63,7 +64,8 @@ When the time expires, the STimer gets armed immediately taking the specified ti
 Parameters:
 
     - obj : A pointer to the STimer object.
-    - Time : The expiration time(Must be specified in seconds). 
+    - Time : The expiration time in seconds. Build it with <qTime_Seconds>
+             (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is enabled). 
  
     > Note 1: The OS must be running before using STimers.
     > Note 2: The expiration time should be at least, two times greater than
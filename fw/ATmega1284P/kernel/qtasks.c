@@ -23,11 +23,13 @@ qBool_t qTask_Notification_Send( qTask_t * const Task, void* eventdata ){
     qBool_t RetValue = qFalse;
 
     if( NULL != Task ){
+        qCritical_Enter();
         if( Task->qPrivate.Notification < QMAX_NOTIFICATION_VALUE ){
             ++Task->qPrivate.Notification;
             Task->qPrivate.AsyncData = eventdata;
             RetValue = qTrue;
         }
+        qCritical_Exit();
     }
     return RetValue;
 }
@@ -81,6 +83,11 @@ qBool_t qTask_HasPendingNotifications( const qTask_t * const Task  ){
         if( Task->qPrivate.Notification > (qNotifier_t)0 ){
             RetValue = qTrue;
         }
+        #if ( Q_TASK_MAILBOX == 1 )
+        else if( qTask_Mailbox_Count( Task ) > 0u ){
+            RetValue = qTrue;
+        }
+        #endif
         else{
             #if ( Q_PRIO_QUEUE_SIZE > 0 )  
                 RetValue = qOS_PriorityQueue_IsTaskInside( Task );
@@ -89,6 +96,151 @@ qBool_t qTask_HasPendingNotifications( const qTask_t * const Task  ){
     }
     return RetValue;
 }
+#if ( Q_TASK_MAILBOX == 1 )
+/*============================================================================*/
+/*qBool_t qTask_Attach_Mailbox( qTask_t * const Task, qTask_Mailbox_t * const Mailbox, qTask_Mail_t * const Slots, const size_t Size )
+
+Attach a notification mailbox to the task. Unlike the simple notifications, 
+that only keep the last payload, every notification posted with 
+<qTask_Notification_Post> gets its own slot, so bursts do not lose data.
+
+Parameters:
+
+    - Task : A pointer to the task node.
+    - Mailbox : A pointer to the mailbox object. Pass NULL to detach the 
+                current mailbox.
+    - Slots : An array of qTask_Mail_t used as the mailbox storage.
+    - Size : The number of elements in <Slots>.
+
+Return value:
+
+    Returns qTrue on success, otherwise returns qFalse;
+*/
+qBool_t qTask_Attach_Mailbox( qTask_t * const Task, qTask_Mailbox_t * const Mailbox, qTask_Mail_t * const Slots, const size_t Size ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Task ){
+        if( NULL == Mailbox ){
+            Task->qPrivate.Mailbox = NULL;
+            RetValue = qTrue;
+        }
+        else if( ( NULL != Slots ) && ( Size > 0u ) ){
+            Mailbox->qPrivate.Slots = Slots;
+            Mailbox->qPrivate.Size = Size;
+            Mailbox->qPrivate.Head = 0u;
+            Mailbox->qPrivate.Count = 0u;
+            Mailbox->qPrivate.Current.Data = NULL;
+            Mailbox->qPrivate.Current.Value = 0uL;
+            Task->qPrivate.Mailbox = Mailbox;
+            RetValue = qTrue;
+        }
+        else{
+            /*this case does not need to be handled*/
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*qBool_t qTask_Notification_Post( qTask_t * const Task, void* eventdata, const qNotifier_t Value )
+
+Posts a notification with its payload and value in the task mailbox. The task
+gets ready with the "byNotificationMailbox" trigger (even if task is disabled)
+and a pointer to the front mail (qTask_Mail_t) will be available in the 
+<EventData> field. The remaining mails can be consumed in the same dispatch 
+with <qTask_Mailbox_Receive>. Can be used from interrupts.
+
+Parameters:
+
+    - Task : Pointer to the task node.
+    - eventdata : Specific event user-data.
+    - Value : The notification value.
+
+Return value:
+
+    qTrue on success. qFalse if the task has no mailbox or the mailbox is full.
+*/
+qBool_t qTask_Notification_Post( qTask_t * const Task, void* eventdata, const qNotifier_t Value ){
+    qBool_t RetValue = qFalse;
+
+    if( NULL != Task ){
+        qTask_Mailbox_t * const Mailbox = Task->qPrivate.Mailbox;
+
+        if( NULL != Mailbox ){
+            qCritical_Enter();
+            if( Mailbox->qPrivate.Count < Mailbox->qPrivate.Size ){
+                size_t Tail = Mailbox->qPrivate.Head + Mailbox->qPrivate.Count;
+
+                if( Tail >= Mailbox->qPrivate.Size ){
+                    Tail -= Mailbox->qPrivate.Size;
+                }
+                Mailbox->qPrivate.Slots[ Tail ].Data = eventdata;
+                Mailbox->qPrivate.Slots[ Tail ].Value = Value;
+                ++Mailbox->qPrivate.Count;
+                RetValue = qTrue;
+            }
+            qCritical_Exit();
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*size_t qTask_Mailbox_Receive( qTask_t * const Task, qTask_Mail_t * const dest, const size_t Max )
+
+Extracts the pending mails from the task mailbox in arrival order. Used in the 
+task callback to consume all the pending notifications in a single dispatch.
+
+Parameters:
+
+    - Task : Pointer to the task node.
+    - dest : An array of qTask_Mail_t where the mails will be copied.
+    - Max : The maximum number of mails to extract.
+
+Return value:
+
+    The number of mails extracted.
+*/
+size_t qTask_Mailbox_Receive( qTask_t * const Task, qTask_Mail_t * const dest, const size_t Max ){
+    size_t RetValue = 0u;
+
+    if( ( NULL != Task ) && ( NULL != dest ) ){
+        qTask_Mailbox_t * const Mailbox = Task->qPrivate.Mailbox;
+
+        if( NULL != Mailbox ){
+            qCritical_Enter(); /*the posts from interrupts must not interleave with the extraction*/
+            while( ( RetValue < Max ) && ( Mailbox->qPrivate.Count > 0u ) ){
+                dest[ RetValue++ ] = Mailbox->qPrivate.Slots[ Mailbox->qPrivate.Head ];
+                Mailbox->qPrivate.Head = ( Mailbox->qPrivate.Head + 1u < Mailbox->qPrivate.Size )? Mailbox->qPrivate.Head + 1u : 0u;
+                --Mailbox->qPrivate.Count;
+            }
+            qCritical_Exit();
+        }
+    }
+    return RetValue;
+}
+/*============================================================================*/
+/*size_t qTask_Mailbox_Count( const qTask_t * const Task )
+
+Returns the number of mails pending in the task mailbox.
+
+Parameters:
+
+    - Task : Pointer to the task node.
+
+Return value:
+
+    The number of pending mails. 0 if the task has no mailbox.
+*/
+size_t qTask_Mailbox_Count( const qTask_t * const Task ){
+    size_t RetValue = 0u;
+
+    if( NULL != Task ){
+        if( NULL != Task->qPrivate.Mailbox ){
+            RetValue = Task->qPrivate.Mailbox->qPrivate.Count;
+        }
+    }
+    return RetValue;
+}
+#endif
 /*============================================================================*/
 /*
 qState_t qTask_Get_State( const qTask_t * const Task )
@@ -164,8 +316,9 @@ Set/Change the Task execution interval
 Parameters:
 
     - Task : A pointer to the task node.
-    - Value : Execution interval defined in seconds (floating-point format). 
-              For immediate execution (tValue = qTimeImmediate).
+    - Value : Execution interval defined in seconds. Build it with 
+              <qTime_Seconds> (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is 
+              enabled). For immediate execution (tValue = qTimeImmediate).
 */
 void qTask_Set_Time( qTask_t * const Task, const qTime_t Value ){
     if( NULL != Task ){
@@ -207,6 +360,77 @@ void qTask_Set_Priority( qTask_t * const Task, const qPriority_t Value ){
         Task->qPrivate.Priority = Value; 
     }
 }
+#if ( QTASK_DEADLINES == 1 )
+/*============================================================================*/
+/*void qTask_Set_Deadline( qTask_t * const Task, const qTime_t Value )
+
+Set/Change the task relative deadline. The absolute deadline is computed on 
+every release as the release time plus this value. A release that finishes past 
+its absolute deadline is reported as a deadline miss. When the EDF policy is 
+enabled, the ready tasks are dispatched in ascending order of their absolute 
+deadline.
+
+Parameters:
+
+    - Task : A pointer to the task node.
+    - Value : The relative deadline defined in seconds. Build it with 
+              <qTime_Seconds> (unsigned Q16.16 if Q_SETUP_TIME_FIXEDPOINT is 
+              enabled). Use qTimeImmediate to take the task period as the deadline 
+              (implicit deadline).
+*/
+void qTask_Set_Deadline( qTask_t * const Task, const qTime_t Value ){
+    if( NULL != Task ){
+        Task->qPrivate.Deadline = qClock_Convert2Clock( Value );
+    }
+}
+/*============================================================================*/
+/*void qTask_Set_ReloadPolicy( qTask_t * const Task, const qTask_ReloadPolicy_t Policy )
+
+Set/Change how the task timer is rearmed after a time-elapsed release.
+
+Parameters:
+
+    - Task : A pointer to the task node.
+    - Policy : Use one of the following values:
+            qTask_FixedDelay : The next release is scheduled one period after the
+                               moment the release was detected, so any latency 
+                               slips the schedule (default).
+            qTask_FixedRate : The next release is scheduled one period after the 
+                              nominal release, so the schedule never drifts. If
+                              the task falls behind, the lost releases are 
+                              performed back-to-back (catch-up).
+            qTask_FixedRateSkip : Like qTask_FixedRate, but the lost releases are
+                                  skipped and the next one is aligned to the 
+                                  original phase.
+*/
+void qTask_Set_ReloadPolicy( qTask_t * const Task, const qTask_ReloadPolicy_t Policy ){
+    if( NULL != Task ){
+        qOS_Set_TaskFlags( Task, QTASK_BIT_FIXED_RATE, ( qTask_FixedDelay != Policy )? qTrue : qFalse );
+        qOS_Set_TaskFlags( Task, QTASK_BIT_SKIP_LATE, ( qTask_FixedRateSkip == Policy )? qTrue : qFalse );
+    }
+}
+/*============================================================================*/
+/*qUINT32_t qTask_Get_DeadlineMisses( const qTask_t * const Task )
+
+Retrieve the number of releases of the task that finished past their deadline.
+
+Parameters:
+
+    - Task : A pointer to the task node.
+
+Return value:
+
+    The number of deadline misses.
+*/
+qUINT32_t qTask_Get_DeadlineMisses( const qTask_t * const Task ){
+    qUINT32_t RetValue = 0uL;
+
+    if( NULL != Task ){
+        RetValue = Task->qPrivate.DeadlineMisses;
+    }
+    return RetValue;
+}
+#endif
 /*============================================================================*/
 /*void qTask_Set_Callback( qTask_t * const Task, const qTaskFcn_t CallbackFcn )
 
@@ -469,9 +693,11 @@ qBool_t qTask_EventFlags_Check( qTask_t * const Task, qTask_Flag_t FlagsToCheck,
     qBool_t RetValue = qFalse;
     
     if( NULL != Task ){
-        qTask_Flag_t CurrentEventBits = Task->qPrivate.Flags & QTASK_EVENTFLAGS_RMASK;
+        qTask_Flag_t CurrentEventBits;
 
         FlagsToCheck &= QTASK_EVENTFLAGS_RMASK;
+        qCritical_Enter(); /*the test and the clear must be performed as a single operation*/
+        CurrentEventBits = Task->qPrivate.Flags & QTASK_EVENTFLAGS_RMASK;
         if( qFalse == CheckForAll ){
             if( (qTask_Flag_t)0 != ( CurrentEventBits & FlagsToCheck ) ){
                 RetValue = qTrue;
@@ -485,6 +711,7 @@ qBool_t qTask_EventFlags_Check( qTask_t * const Task, qTask_Flag_t FlagsToCheck,
         if( ( qTrue == RetValue )  && ( qTrue == ClearOnExit ) ){
             Task->qPrivate.Flags &= ~FlagsToCheck;
         }
+        qCritical_Exit();
     }
     return RetValue;
 }
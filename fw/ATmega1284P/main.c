@@ -27,29 +27,19 @@
 // global variable to count the number of overflows
 volatile uint8_t TickCount;
  
- void WrapperGpio(uint8_t pinvalue);
-
-SFPWM_data_t SFPWM_data;
+SFPWM_bank_t SFPWM_bank;
 
 int main(void)
 {
     setup_mcu();
-   SFPWM_Init(&SFPWM_data ,WrapperGpio , 0.001 ,10.0);
-   SFPWM_SetDuty( &SFPWM_data , 10);
-    qOS_Setup(NULL, 0.001, App_Task_Idle);
-    qOS_Add_Task(&TaskHandlerLed1,App_Task_led1_Callback, qMedium_Priority, 1, qPeriodic, qEnabled, NULL);
-    qOS_Add_Task(&TaskHandlerLed2,App_Task_led2_Callback, qMedium_Priority, 0.5, qPeriodic, qEnabled, NULL);
+   SFPWM_BankInit(&SFPWM_bank, &PORTC, (1 << 0), 12500);  /*PC0, 12500 ticks of 8us (timer1) -> 10Hz*/
+   SFPWM_BankSetDuty(&SFPWM_bank, 0, 10);
+   timer1_init(SFPWM_BankFirstEdge(&SFPWM_bank));
+    qCritical_SetInterruptsED(interrupts_restore, interrupts_disable); /*SREG save + cli / SREG restore*/
+    qOS_Setup(NULL, 1000uL, App_Task_Idle); /*1ms tick given in Hz : fixed-point time base*/
+    qClock_SetSubTickProvider(timer0_subtick, 126uL); /*OCR0A + 1 counts per tick*/
+    qOS_Add_Task(&TaskHandlerLed1,App_Task_led1_Callback, qMedium_Priority, qTime_Seconds(1.0), qPeriodic, qEnabled, NULL);
+    qOS_Add_Task(&TaskHandlerLed2,App_Task_led2_Callback, qMedium_Priority, qTime_Seconds(0.5), qPeriodic, qEnabled, NULL);
     qOS_Run();
 
   }
-
-  
-  void WrapperGpio(uint8_t pinvalue){
-      if( pinvalue == 1){
-	    PORTC = (1 << 0); //PC0  on
-	 /*prendo pin*/
-	 }else {
-	    PORTC = (0 << 0);   //PC0  off
-	    /*apago*/
-	  }
-     }
@@ -33,6 +33,36 @@ void timer0_init()
      sei();
 }
 
+// timer1 free running at 125kHz (8us), the soft pwm bank programs OCR1A with the next edge
+void timer1_init(uint16_t first_compare)
+{
+     TCCR1A = 0;    // normal mode, the compare match does not reset the counter
+     TCNT1 = 0;
+     OCR1A = first_compare;
+     TIFR1 = (1 << OCF1A);
+     TIMSK1 |= (1 << OCIE1A);
+     TCCR1B = (1 << CS11) | (1 << CS10);   // Set prescaler to 64 and start
+}
+
+// sub-tick count for the OS timestamps : TCNT0 counts 0..OCR0A within every 1ms tick (8us resolution)
+uint32_t timer0_subtick(void)
+{
+   return (uint32_t)TCNT0;
+}
+
+// interrupt disabler/restorer for the OS critical sections : save SREG (global interrupt flag) and restore it on exit
+uint32_t interrupts_disable(void)
+{
+   uint32_t sreg = (uint32_t)SREG;
+   cli();
+   return sreg;
+}
+
+void interrupts_restore(uint32_t sreg)
+{
+   SREG = (uint8_t)sreg;
+}
+
 void setup_mcu(){
       DDRC |= (1 << 1) | (1 << 0);  // pC0  & pc1 as  output
       DDRB |= (1 << 1) | (1 << 0);   // pB0  as output
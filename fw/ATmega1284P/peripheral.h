@@ -7,6 +7,8 @@
  #ifndef __PERIPHERAL_H_
  #define __PERIPHERAL_H_
  
+ #include <stdint.h>
+ 
  
  #ifdef __cplusplus
  extern "C" {
@@ -15,6 +17,14 @@
     
 void timer0_init();
 
+void timer1_init(uint16_t first_compare);
+
+uint32_t timer0_subtick(void);
+
+uint32_t interrupts_disable(void);
+
+void interrupts_restore(uint32_t sreg);
+
 void setup_mcu();
 
 #ifdef __cplusplus
@@ -13,14 +13,24 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+/* compiler barrier : the table is not volatile, so its writes must not be moved across the "pending" handshake with the isr */
+#define SFPWM_BARRIER()     __asm__ __volatile__( "" ::: "memory" )
 
 static int16_t SFPWM_Rounding(float num);
+static uint16_t SFPWM_Percent2Ticks(uint16_t percent, uint16_t period);
+static void SFPWM_BankBuild(SFPWM_bank_t *obj);
+static uint8_t SFPWM_BankAddEdge(SFPWM_table_t *t, uint8_t n, uint16_t tick, uint8_t toggle, uint8_t lo, uint8_t hi);
+static uint8_t SFPWM_BankBoundary(SFPWM_bank_t *obj);
+
+/* pins toggled by the edge i : the dithered falling edges depend on the sigma-delta carry of the period */
+#define SFPWM_EDGE( t, i, extend )  (uint8_t)( (t)->toggle[i] ^ ( (t)->lo[i] & (uint8_t)~(extend) ) ^ ( (t)->hi[i] & (extend) ) )
 
 void SFPWM_Init(SFPWM_data_t *obj, write_pin_fcn _write_pin, float basetiming ,float freq )
 {   obj->write_pin = _write_pin ; 
     obj->frequency = freq;
     obj->period = (1 / obj->frequency);  //0.1
     obj->basetime = basetiming;   //0.001
+    obj->period_ticks = SFPWM_Rounding( obj->period / obj->basetime );  // float math only here, not in the isr
     obj->count = 0;
 }
 
@@ -28,7 +38,7 @@ void SFPWM_Update(SFPWM_data_t *obj){
 
     ++obj->count;
 
-    if (   SFPWM_Rounding( (obj->period *(1/obj->basetime)) )   == obj->count ){  // overflow period
+    if ( obj->period_ticks == obj->count ){  // overflow period
         obj->count = 0;  // overflow
     }
 
@@ -48,10 +58,258 @@ uint16_t SFPWM_GetStatePin(SFPWM_data_t *obj){
 
 void SFPWM_SetDuty(SFPWM_data_t *obj , uint16_t duty){
     //obj->dutyc = (duty*obj->period  ) / SFPWM_MAX_PERCENTAGE;
-    obj->dutyc = SFPWM_Rounding(  ((duty*(obj->period * (1/obj->basetime)) ) / SFPWM_MAX_PERCENTAGE)  )  ;
+    obj->dutyc = SFPWM_Percent2Ticks( duty, obj->period_ticks );
     //printf(" 1/bt=%d seg=%d \n",(uint16_t)(1/obj->basetime) , (obj->period * (1/obj->basetime)));
 }
 
 static int16_t SFPWM_Rounding(float num){
     return num < 0 ? num  - 0.5 : num + 0.5;
-}
\ No newline at end of file
+}
+
+static uint16_t SFPWM_Percent2Ticks(uint16_t percent, uint16_t period){
+    if( percent > SFPWM_MAX_PERCENTAGE ){
+        percent = SFPWM_MAX_PERCENTAGE;
+    }
+    return (uint16_t)( ( (uint32_t)percent * period + ( SFPWM_MAX_PERCENTAGE / 2 ) ) / SFPWM_MAX_PERCENTAGE );
+}
+
+void SFPWM_BankInit(SFPWM_bank_t *obj, volatile uint8_t *port, uint8_t mask, uint16_t period_ticks){
+    uint8_t i;
+
+    obj->port = port;
+    obj->mask = mask;
+    obj->period = ( period_ticks > 0 ) ? period_ticks : 1;
+    obj->count = 0;
+    obj->next = 0;
+    obj->active = 0;
+    obj->pending = 0;
+    obj->extend = 0;
+    for( i = 0; i < SFPWM_BANK_CHANNELS; i++ ){
+        obj->duty[i] = 0;
+        obj->phase[i] = 0;
+        obj->fraction[i] = 0;
+        obj->sigma[i] = 0;
+    }
+    SFPWM_BankBuild(obj);   // fills the inactive table and marks it pending
+    obj->active ^= 1;       // no isr yet, take it right away
+    obj->pending = 0;
+    obj->out = obj->table[obj->active].initial;
+    *obj->port = (uint8_t)( ( *obj->port & (uint8_t)~obj->mask ) | obj->out );
+}
+
+static uint8_t SFPWM_BankAddEdge(SFPWM_table_t *t, uint8_t n, uint16_t tick, uint8_t toggle, uint8_t lo, uint8_t hi){
+    if( tick != 0 ){    // edges at tick 0 are already in the initial levels
+        t->tick[n] = tick;
+        t->toggle[n] = toggle;
+        t->lo[n] = lo;
+        t->hi[n] = hi;
+        n++;
+    }
+    return n;
+}
+
+/* builds the edges of the next period into the table not used by the isr */
+static void SFPWM_BankBuild(SFPWM_bank_t *obj){
+    SFPWM_table_t *t;
+    uint8_t i, j, n = 0;
+
+    obj->pending = 0;   // the isr can't swap from now on, so "active" is stable
+    SFPWM_BARRIER();    // no table write is hoisted above the release of the pending table
+    t = &obj->table[ obj->active ^ 1 ];
+    t->initial = 0;
+    t->extended = 0;
+    t->dither = 0;
+    for( i = 0; i < SFPWM_BANK_CHANNELS; i++ ){
+        uint8_t pin = (uint8_t)( 1u << i );
+        uint16_t on = obj->phase[i];
+        uint16_t duty = obj->duty[i];
+        uint16_t off, at_zero;
+
+        t->fraction[i] = 0;
+        if( 0 == ( obj->mask & pin ) ){
+            continue;
+        }
+        if( duty >= obj->period ){
+            t->initial |= pin;  // always high
+            continue;
+        }
+        at_zero = ( obj->period - on ) % obj->period;   // tick 0 seen from the rising edge
+        if( at_zero < duty ){
+            t->initial |= pin;
+        }
+        off = on + duty;
+        if( off >= obj->period ){
+            off -= obj->period;
+        }
+        if( 0 == obj->fraction[i] ){
+            if( 0 != duty ){
+                n = SFPWM_BankAddEdge( t, n, on, pin, 0, 0 );
+                n = SFPWM_BankAddEdge( t, n, off, pin, 0, 0 );
+            }
+            continue;   // 0 duty : always low
+        }
+        // dithered : the falling edge lands on "off" or on "off + 1" when the sigma-delta carries
+        t->dither |= pin;
+        t->fraction[i] = obj->fraction[i];
+        if( at_zero == duty ){
+            t->extended |= pin; // the extra tick is the tick 0
+        }
+        n = SFPWM_BankAddEdge( t, n, on, pin, 0, 0 );
+        n = SFPWM_BankAddEdge( t, n, off, 0, pin, 0 );
+        n = SFPWM_BankAddEdge( t, n, ( off + 1 < obj->period ) ? off + 1 : 0, 0, 0, pin );
+    }
+    // sort by tick and merge the edges that share the same tick
+    for( i = 1; i < n; i++ ){
+        uint16_t tick = t->tick[i];
+        uint8_t toggle = t->toggle[i], lo = t->lo[i], hi = t->hi[i];
+
+        for( j = i; j > 0 && t->tick[j - 1] > tick; j-- ){
+            t->tick[j] = t->tick[j - 1];
+            t->toggle[j] = t->toggle[j - 1];
+            t->lo[j] = t->lo[j - 1];
+            t->hi[j] = t->hi[j - 1];
+        }
+        t->tick[j] = tick;
+        t->toggle[j] = toggle;
+        t->lo[j] = lo;
+        t->hi[j] = hi;
+    }
+    for( i = 0, j = 0; i < n; i++ ){
+        if( j > 0 && t->tick[j - 1] == t->tick[i] ){
+            t->toggle[j - 1] ^= t->toggle[i];
+            t->lo[j - 1] ^= t->lo[i];
+            t->hi[j - 1] ^= t->hi[i];
+        }
+        else{
+            t->tick[j] = t->tick[i];
+            t->toggle[j] = t->toggle[i];
+            t->lo[j] = t->lo[i];
+            t->hi[j] = t->hi[i];
+            j++;
+        }
+    }
+    t->nevents = j;
+    SFPWM_BARRIER();    // the whole table is written before the isr can swap to it
+    obj->pending = 1;   // swapped by the isr at the next period boundary
+}
+
+/* period boundary : swap the pending table, run the sigma-delta of the dithered channels, return the levels at tick 0 */
+static uint8_t SFPWM_BankBoundary(SFPWM_bank_t *obj){
+    const SFPWM_table_t *t;
+    uint8_t extend = 0;
+
+    if( obj->pending ){
+        obj->active ^= 1;
+        obj->pending = 0;
+    }
+    t = &obj->table[ obj->active ];
+    obj->next = 0;
+    if( 0 != t->dither ){
+        uint8_t i;
+
+        for( i = 0; i < SFPWM_BANK_CHANNELS; i++ ){ // first order : the carry adds one tick to this period
+            uint8_t sigma = (uint8_t)( obj->sigma[i] + t->fraction[i] );
+
+            if( sigma < obj->sigma[i] ){
+                extend |= (uint8_t)( 1u << i );
+            }
+            obj->sigma[i] = sigma;
+        }
+    }
+    obj->extend = extend;
+    return (uint8_t)( t->initial | ( t->extended & extend ) );
+}
+
+void SFPWM_BankUpdate(SFPWM_bank_t *obj){
+    const SFPWM_table_t *t;
+    uint16_t count = obj->count + 1;
+    uint8_t out = obj->out;
+
+    if( count >= obj->period ){ // new period : resync the levels from the table
+        count = 0;
+        out = SFPWM_BankBoundary(obj);
+    }
+    else{
+        t = &obj->table[ obj->active ];
+        if( obj->next < t->nevents && t->tick[ obj->next ] == count ){
+            out ^= SFPWM_EDGE( t, obj->next, obj->extend );
+            obj->next++;
+        }
+    }
+    obj->count = count;
+    if( out != obj->out ){  // a single register write for the whole bank
+        obj->out = out;
+        *obj->port = (uint8_t)( ( *obj->port & (uint8_t)~obj->mask ) | out );
+    }
+}
+
+uint16_t SFPWM_BankFirstEdge(SFPWM_bank_t *obj){
+    const SFPWM_table_t *t = &obj->table[ obj->active ];
+
+    obj->count = ( t->nevents > 0 ) ? t->tick[0] : obj->period;
+    return obj->count;
+}
+
+uint16_t SFPWM_BankNextEdge(SFPWM_bank_t *obj){
+    const SFPWM_table_t *t = &obj->table[ obj->active ];
+    uint16_t now = obj->count;  // the tick of the compare match that fired
+    uint16_t delta;
+    uint8_t next = obj->next;
+    uint8_t out = obj->out;
+
+    for( ;; ){
+        while( next < t->nevents && ( t->tick[next] <= now || 0 == SFPWM_EDGE( t, next, obj->extend ) ) ){ // every due edge (including the deferred ones) and the dithered edges not taken in this period
+            out ^= SFPWM_EDGE( t, next, obj->extend );
+            next++;
+        }
+        if( next < t->nevents || now < obj->period ){
+            break;
+        }
+        out = SFPWM_BankBoundary(obj);   // period boundary : resync the levels from the table
+        t = &obj->table[ obj->active ];
+        next = 0;
+        now -= obj->period;
+    }
+    delta = ( ( next < t->nevents ) ? t->tick[next] : obj->period ) - now;
+    if( delta < SFPWM_MIN_EDGE_TICKS ){
+        delta = SFPWM_MIN_EDGE_TICKS;   // too close to leave the isr : defer, the edge is served late but never lost
+    }
+    obj->count = now + delta;
+    obj->next = next;
+    if( out != obj->out ){  // a single register write for the whole bank
+        obj->out = out;
+        *obj->port = (uint8_t)( ( *obj->port & (uint8_t)~obj->mask ) | out );
+    }
+    return delta;
+}
+
+void SFPWM_BankSetDuty(SFPWM_bank_t *obj, uint8_t channel, uint16_t duty){
+    SFPWM_BankSetDutyTicks( obj, channel, SFPWM_Percent2Ticks( duty, obj->period ) );
+}
+
+void SFPWM_BankSetPhase(SFPWM_bank_t *obj, uint8_t channel, uint16_t phase){
+    SFPWM_BankSetPhaseTicks( obj, channel, SFPWM_Percent2Ticks( phase, obj->period ) % obj->period );
+}
+
+void SFPWM_BankSetDutyTicks(SFPWM_bank_t *obj, uint8_t channel, uint16_t ticks){
+    SFPWM_BankSetDutyDither( obj, channel, ticks, 0 );
+}
+
+void SFPWM_BankSetDutyDither(SFPWM_bank_t *obj, uint8_t channel, uint16_t ticks, uint8_t fraction){
+    if( channel < SFPWM_BANK_CHANNELS ){
+        if( ticks >= obj->period ){
+            ticks = obj->period;
+            fraction = 0;
+        }
+        obj->duty[channel] = ticks;
+        obj->fraction[channel] = fraction;
+        SFPWM_BankBuild(obj);
+    }
+}
+
+void SFPWM_BankSetPhaseTicks(SFPWM_bank_t *obj, uint8_t channel, uint16_t ticks){
+    if( channel < SFPWM_BANK_CHANNELS ){
+        obj->phase[channel] = ticks % obj->period;
+        SFPWM_BankBuild(obj);
+    }
+}
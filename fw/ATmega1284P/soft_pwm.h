@@ -26,6 +26,9 @@ extern "C" {
 
 #define SFPWM_MAX_COUNTER   65535  /*!<  MAXIMO VALOR TMR1*/ 
 #define SFPWM_MAX_PERCENTAGE   100  /*!<  MAXIMO VALOR*/ 
+#define SFPWM_BANK_CHANNELS    8    /*!<  one channel per pin of an 8-bit port*/
+#define SFPWM_BANK_EVENTS      ( 3 * SFPWM_BANK_CHANNELS )  /*!<  rising + falling edge per channel, + the dithered falling edge*/
+#define SFPWM_MIN_EDGE_TICKS   4    /*!<  minimum distance between compare interrupts, closer edges are deferred*/
 
 /**
  * @brief pointer to function
@@ -42,8 +45,44 @@ typedef struct  {
     float frequency;
     float basetime;
     float period;
+    uint16_t period_ticks;  /*!< period in ticks, precomputed in SFPWM_Init*/
 }SFPWM_data_t;
 
+/**
+ * @brief precomputed edges of a bank for one pwm period
+ **/
+typedef struct {
+    uint8_t initial;                        /*!< pin levels at tick 0*/
+    uint8_t extended;                       /*!< dithered pins high at tick 0 only on the periods with the extra tick*/
+    uint8_t dither;                         /*!< dithered pins*/
+    uint8_t nevents;                        /*!< number of edges inside the period*/
+    uint16_t tick[ SFPWM_BANK_EVENTS ];     /*!< edge ticks in ascending order*/
+    uint8_t toggle[ SFPWM_BANK_EVENTS ];    /*!< pins toggled at each edge tick*/
+    uint8_t lo[ SFPWM_BANK_EVENTS ];        /*!< pins toggled at each edge tick, only without the extra tick*/
+    uint8_t hi[ SFPWM_BANK_EVENTS ];        /*!< pins toggled at each edge tick, only with the extra tick*/
+    uint8_t fraction[ SFPWM_BANK_CHANNELS ];    /*!< sub-tick duty of each channel in 1/256 ticks*/
+}SFPWM_table_t;
+
+/**
+ * @brief multi-channel pwm bank : up to 8 channels on the same port, integer only
+ **/
+typedef struct {
+    volatile uint8_t *port;     /*!< output register, written once per edge*/
+    uint8_t mask;               /*!< pins driven by the bank*/
+    uint16_t period;            /*!< period in ticks*/
+    volatile uint16_t count;
+    volatile uint8_t out;       /*!< current pin levels*/
+    volatile uint8_t next;      /*!< next edge of the active table*/
+    volatile uint8_t active;    /*!< table used by the isr*/
+    volatile uint8_t pending;   /*!< the other table holds new values*/
+    volatile uint8_t extend;    /*!< dithered pins with the extra tick in this period*/
+    uint8_t sigma[ SFPWM_BANK_CHANNELS ];   /*!< sigma-delta accumulators, isr side*/
+    uint8_t fraction[ SFPWM_BANK_CHANNELS ];    /*!< sub-tick duty in 1/256 ticks*/
+    uint16_t duty[ SFPWM_BANK_CHANNELS ];   /*!< high time in ticks*/
+    uint16_t phase[ SFPWM_BANK_CHANNELS ];  /*!< rising edge in ticks*/
+    SFPWM_table_t table[ 2 ];               /*!< double buffer, swapped at the period boundary*/
+}SFPWM_bank_t;
+
 /**
  * @brief 
  * 
@@ -85,6 +124,97 @@ uint16_t SFPWM_GetStatePin(SFPWM_data_t *obj);
  */
 void SFPWM_SetDuty(SFPWM_data_t *obj , uint16_t duty);
 
+/**
+ * @brief init a pwm bank, all channels start at 0% duty
+ * 
+ * @param obj pointer to object pwm bank
+ * @param port output register (e.g. &PORTC)
+ * @param mask pins driven by the bank, channel n is the pin n of the port
+ * @param period_ticks pwm period given in isr ticks (e.g. 100 -> 10Hz with a 1ms tick)
+ */
+void SFPWM_BankInit(SFPWM_bank_t *obj, volatile uint8_t *port, uint8_t mask, uint16_t period_ticks);
+
+/**
+ * @brief isr handler, cost does not depend on the number of channels
+ * 
+ * @param obj pointer to object pwm bank
+ */
+void SFPWM_BankUpdate(SFPWM_bank_t *obj);
+
+/**
+ * @brief set duty cicle 0-100 of a channel, applied at the next period
+ * 
+ * @param obj pointer to object pwm bank
+ * @param channel 0-7 (pin of the port)
+ * @param duty 0-100
+ */
+void SFPWM_BankSetDuty(SFPWM_bank_t *obj, uint8_t channel, uint16_t duty);
+
+/**
+ * @brief set phase offset 0-100 of a channel, applied at the next period
+ * 
+ * @param obj pointer to object pwm bank
+ * @param channel 0-7 (pin of the port)
+ * @param phase 0-100 percent of the period where the channel turns on
+ */
+void SFPWM_BankSetPhase(SFPWM_bank_t *obj, uint8_t channel, uint16_t phase);
+
+/**
+ * @brief set the high time of a channel in ticks (full resolution), applied at the next period
+ * 
+ * @param obj pointer to object pwm bank
+ * @param channel 0-7 (pin of the port)
+ * @param ticks 0-period_ticks
+ */
+void SFPWM_BankSetDutyTicks(SFPWM_bank_t *obj, uint8_t channel, uint16_t ticks);
+
+/**
+ * @brief set the high time of a channel with sub-tick resolution, applied at the next period.
+ *        A first order sigma-delta adds one tick to (fraction/256) of the periods, so the
+ *        average duty is (ticks + fraction/256) / period_ticks without raising the tick rate.
+ *        The carry is evaluated once per period, the per-tick isr cost does not change.
+ * 
+ * @param obj pointer to object pwm bank
+ * @param channel 0-7 (pin of the port)
+ * @param ticks integer part of the high time 0-period_ticks
+ * @param fraction sub-tick part of the high time in 1/256 ticks
+ */
+void SFPWM_BankSetDutyDither(SFPWM_bank_t *obj, uint8_t channel, uint16_t ticks, uint8_t fraction);
+
+/**
+ * @brief set the rising edge of a channel in ticks (full resolution), applied at the next period
+ * 
+ * @param obj pointer to object pwm bank
+ * @param channel 0-7 (pin of the port)
+ * @param ticks 0-(period_ticks-1)
+ */
+void SFPWM_BankSetPhaseTicks(SFPWM_bank_t *obj, uint8_t channel, uint16_t ticks);
+
+/**
+ * @brief compare mode : ticks from SFPWM_BankInit until the first edge,
+ *        used to program the first compare match of the timer (call it once, right before starting the timer)
+ * 
+ * @param obj pointer to object pwm bank
+ * @return uint16_t ticks until the first edge
+ */
+uint16_t SFPWM_BankFirstEdge(SFPWM_bank_t *obj);
+
+/**
+ * @brief compare mode isr handler : applies the due edge(s) and returns the
+ *        ticks until the next one, so the isr only fires on pin transitions.
+ *        Use it instead of SFPWM_BankUpdate with a free running 16-bit timer:
+ *        OCRnA += SFPWM_BankNextEdge(&bank);
+ *        Edges closer than SFPWM_MIN_EDGE_TICKS are deferred and served
+ *        together, less than SFPWM_MIN_EDGE_TICKS late. A pulse shorter than
+ *        that is stretched when its first edge is served on time, and dropped
+ *        for that period when both edges land in the same deferral. The period
+ *        never drifts (see test/sim_softpwm.c).
+ * 
+ * @param obj pointer to object pwm bank
+ * @return uint16_t ticks until the next edge (1-period_ticks)
+ */
+uint16_t SFPWM_BankNextEdge(SFPWM_bank_t *obj);
+
 
 
 #ifdef __cplusplus
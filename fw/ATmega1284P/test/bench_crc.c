@@ -0,0 +1,172 @@
+/*
+Throughput benchmark of the qCRC module in its four Q_CRC_MODE implementations
+(host build).
+
+The mode is a build option, so kernel/qcrc.c is compiled here once per mode 
+with its symbols renamed. Every mode is checked against the check values of 
+"123456789" and against the bitwise mode for random blocks fed in random 
+chunks, before its throughput is measured.
+*/
+#include "QuarkTS.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_BLOCK_SIZE    ( 4096u )
+#define BENCH_BYTES         ( 64uL*1024uL*1024uL )
+#define CHECK_BLOCKS        ( 2000u )
+
+typedef struct{
+    const char *Name;
+    qUINT8_t (*CRC8)( qUINT8_t crc, const void *Data, size_t n );
+    qUINT16_t (*CRC16)( qUINT16_t crc, const void *Data, size_t n );
+    qUINT32_t (*CRC32)( qUINT32_t crc, const void *Data, size_t n );
+}bench_CRC_t;
+
+/*every inclusion of the kernel source gets its own names*/
+#define BENCH_NAME_( m, n )     bench_##m##_##n
+#define BENCH_NAME( m, n )      BENCH_NAME_( m, n )
+#define qCRC8_Update            BENCH_NAME( BENCH_MODE, CRC8_Update )
+#define qCRC16_Update           BENCH_NAME( BENCH_MODE, CRC16_Update )
+#define qCRC32_Update           BENCH_NAME( BENCH_MODE, CRC32_Update )
+#define qCRC8                   BENCH_NAME( BENCH_MODE, CRC8 )
+#define qCRC16                  BENCH_NAME( BENCH_MODE, CRC16 )
+#define qCRC32                  BENCH_NAME( BENCH_MODE, CRC32 )
+#define qCRC8_Table             BENCH_NAME( BENCH_MODE, CRC8_Table )
+#define qCRC16_Table            BENCH_NAME( BENCH_MODE, CRC16_Table )
+#define qCRC32_Table            BENCH_NAME( BENCH_MODE, CRC32_Table )
+#define qCRC32_Slice            BENCH_NAME( BENCH_MODE, CRC32_Slice )
+
+#undef Q_CRC_MODE
+#define Q_CRC_MODE              ( 0 )
+#define BENCH_MODE              Bitwise
+#include "../kernel/qcrc.c"
+static const bench_CRC_t bench_Bitwise = { "bitwise", qCRC8_Update, qCRC16_Update, qCRC32_Update };
+
+#undef Q_CRC_MODE
+#undef QCRC_SLICE_BY_8
+#undef BENCH_MODE
+#define Q_CRC_MODE              ( 1 )
+#define BENCH_MODE              Nibble
+#include "../kernel/qcrc.c"
+static const bench_CRC_t bench_Nibble = { "nibble table", qCRC8_Update, qCRC16_Update, qCRC32_Update };
+
+#undef Q_CRC_MODE
+#undef QCRC_SLICE_BY_8
+#undef BENCH_MODE
+#define Q_CRC_MODE              ( 2 )
+#define BENCH_MODE              Table
+#include "../kernel/qcrc.c"
+static const bench_CRC_t bench_Table = { "byte table", qCRC8_Update, qCRC16_Update, qCRC32_Update };
+
+#undef Q_CRC_MODE
+#undef QCRC_SLICE_BY_8
+#undef BENCH_MODE
+#define Q_CRC_MODE              ( 3 )
+#define BENCH_MODE              Slice
+#include "../kernel/qcrc.c"
+static const bench_CRC_t bench_Slice = { "slice-by-8", qCRC8_Update, qCRC16_Update, qCRC32_Update };
+
+static unsigned long long rng = 88172645463325252uLL;
+
+static unsigned long long xorshift( void ){
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng;
+}
+
+static unsigned long failed = 0uL;
+
+static void check( const bench_CRC_t * const m ){
+    static qUINT8_t block[ BENCH_BLOCK_SIZE ];
+    const char *v = "123456789";
+    const qUINT32_t check32 = qCRC32_Final( m->CRC32( QCRC32_INIT, v, 9u ) );
+    size_t i;
+
+    if( ( 0xF4u != m->CRC8( QCRC8_INIT, v, 9u ) ) || ( 0x29B1u != m->CRC16( QCRC16_INIT, v, 9u ) ) || ( 0xCBF43926uL != check32 ) ){
+        printf( "FAIL %s : check values\n", m->Name );
+        ++failed;
+    }
+    for( i = 0u ; i < CHECK_BLOCKS ; ++i ){ /*a random block against the bitwise mode, fed in random chunks*/
+        const size_t n = (size_t)( xorshift() % BENCH_BLOCK_SIZE );
+        qUINT8_t c8 = QCRC8_INIT;
+        qUINT16_t c16 = QCRC16_INIT;
+        qUINT32_t c32 = QCRC32_INIT;
+        size_t k, done = 0u;
+
+        for( k = 0u ; k < n ; ++k ){
+            block[ k ] = (qUINT8_t)xorshift();
+        }
+        while( done < n ){
+            const size_t chunk = 1u + (size_t)( xorshift() % ( n - done ) );
+
+            c8 = m->CRC8( c8, &block[ done ], chunk );
+            c16 = m->CRC16( c16, &block[ done ], chunk );
+            c32 = m->CRC32( c32, &block[ done ], chunk );
+            done += chunk;
+        }
+        if( ( c8 != bench_Bitwise.CRC8( QCRC8_INIT, block, n ) ) || ( c16 != bench_Bitwise.CRC16( QCRC16_INIT, block, n ) ) ||
+            ( c32 != bench_Bitwise.CRC32( QCRC32_INIT, block, n ) ) ){
+            if( ++failed <= 10uL ){
+                printf( "FAIL %s : %zu bytes block\n", m->Name, n );
+            }
+        }
+    }
+}
+
+static double megabytesPerSecond( clock_t t0, unsigned long bytes ){
+    const double dt = (double)( clock() - t0 )/CLOCKS_PER_SEC;
+
+    return ( dt > 0.0 )? (double)bytes/dt/1e6 : 0.0;
+}
+
+static void bench( const bench_CRC_t * const m, unsigned long bytes ){
+    static qUINT8_t block[ BENCH_BLOCK_SIZE ];
+    volatile qUINT32_t sink;
+    double r8, r16, r32;
+    unsigned long done;
+    qUINT8_t c8 = QCRC8_INIT;
+    qUINT16_t c16 = QCRC16_INIT;
+    qUINT32_t c32 = QCRC32_INIT;
+    clock_t t0;
+    size_t i;
+
+    for( i = 0u ; i < BENCH_BLOCK_SIZE ; ++i ){
+        block[ i ] = (qUINT8_t)xorshift();
+    }
+    t0 = clock();
+    for( done = 0uL ; done < bytes ; done += BENCH_BLOCK_SIZE ){
+        c8 = m->CRC8( c8, block, BENCH_BLOCK_SIZE );
+    }
+    r8 = megabytesPerSecond( t0, bytes );
+    t0 = clock();
+    for( done = 0uL ; done < bytes ; done += BENCH_BLOCK_SIZE ){
+        c16 = m->CRC16( c16, block, BENCH_BLOCK_SIZE );
+    }
+    r16 = megabytesPerSecond( t0, bytes );
+    t0 = clock();
+    for( done = 0uL ; done < bytes ; done += BENCH_BLOCK_SIZE ){
+        c32 = m->CRC32( c32, block, BENCH_BLOCK_SIZE );
+    }
+    r32 = megabytesPerSecond( t0, bytes );
+    sink = (qUINT32_t)c8 ^ (qUINT32_t)c16 ^ c32;
+    (void)sink;
+    printf( "%-12s : CRC-8 %7.1f MB/s, CRC-16 %7.1f MB/s, CRC-32 %7.1f MB/s\n", m->Name, r8, r16, r32 );
+}
+
+int main( void ){
+    static const bench_CRC_t * const modes[] = { &bench_Bitwise, &bench_Nibble, &bench_Table, &bench_Slice };
+    size_t i;
+
+    for( i = 0u ; i < sizeof(modes)/sizeof(modes[0]) ; ++i ){
+        check( modes[ i ] );
+    }
+    printf( "qCRC : %s\n", ( 0uL == failed )? "all modes match the check values and the bitwise mode" : "MISMATCH" );
+    for( i = 0u ; i < sizeof(modes)/sizeof(modes[0]) ; ++i ){ /*the bitwise mode gets an eighth of the data*/
+        bench( modes[ i ], ( 0u == i )? ( BENCH_BYTES/8uL ) : BENCH_BYTES );
+    }
+
+    return ( 0uL == failed )? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,100 @@
+/*
+Benchmark of the word-at-a-time string scanning of qIOUtil_BufStrLen and 
+qIOUtil_BufStrChr against the byte loops of qIOUtil_StrLen and qIOUtil_StrChr
+(host build).
+
+The results are first checked against the byte loops for every length, offset
+and position of the searched character, each string in a heap block of exactly
+its buffer size, so an AddressSanitizer build reports any read past it.
+*/
+#include "QuarkTS.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_CHECK_SIZE      ( 80u )
+#define BENCH_SIZE          ( 256u )
+#define BENCH_ROUNDS        ( 200000L )
+
+static unsigned long failed = 0uL;
+
+static void check( size_t size ){
+    char *buf = malloc( size );
+    size_t len, pos;
+
+    for( len = 0u ; len <= size ; ++len ){ /*len == size : not terminated*/
+        for( pos = 0u ; pos <= len ; ++pos ){
+            size_t i;
+
+            for( i = 0u ; i < size ; ++i ){
+                buf[ i ] = (char)( 'a' + (char)( i % 26u ) );
+            }
+            if( len < size ){
+                buf[ len ] = '\0';
+            }
+            if( pos < len ){
+                buf[ pos ] = '\r';
+            }
+            if( ( qIOUtil_BufStrLen( buf, size ) != qIOUtil_StrLen( buf, size ) ) ||
+                ( qIOUtil_BufStrChr( buf, '\r', size ) != qIOUtil_StrChr( buf, '\r', size ) ) ||
+                ( qIOUtil_BufStrChr( buf, '\0', size ) != qIOUtil_StrChr( buf, '\0', size ) ) ){
+                if( ++failed <= 10uL ){
+                    printf( "FAIL size=%zu len=%zu pos=%zu\n", size, len, pos );
+                }
+            }
+        }
+    }
+    free( buf );
+}
+
+static double nsPerCall( clock_t t0, long calls ){
+    return 1e9*(double)( clock() - t0 )/CLOCKS_PER_SEC/(double)calls;
+}
+
+int main( void ){
+    static char text[ BENCH_SIZE ];
+    volatile size_t sink = 0u;
+    size_t size, offset;
+    clock_t t0;
+    long r;
+
+    for( size = 1u ; size <= MAX_CHECK_SIZE ; ++size ){
+        check( size );
+    }
+    printf( "qIOUtil_BufStrLen/BufStrChr : %s\n", ( 0uL == failed )? "match the byte loops" : "MISMATCH" );
+
+    for( offset = 0u ; offset < ( BENCH_SIZE - 1u ) ; ++offset ){
+        text[ offset ] = (char)( 'A' + (char)( offset % 26u ) );
+    }
+    text[ BENCH_SIZE - 1u ] = '\0';
+    for( size = 16u ; size <= BENCH_SIZE ; size *= 4u ){
+        const char *s = &text[ BENCH_SIZE - size ]; /*a (size - 1) characters string*/
+        double tb, tw, tc, tcb;
+
+        t0 = clock();
+        for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+            sink += qIOUtil_StrLen( s, size );
+        }
+        tb = nsPerCall( t0, BENCH_ROUNDS );
+        t0 = clock();
+        for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+            sink += qIOUtil_BufStrLen( s, size );
+        }
+        tw = nsPerCall( t0, BENCH_ROUNDS );
+        t0 = clock();
+        for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+            sink += (size_t)( NULL != qIOUtil_BufStrChr( s, '\r', size ) );
+        }
+        tc = nsPerCall( t0, BENCH_ROUNDS );
+        t0 = clock();
+        for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+            sink += (size_t)( NULL != qIOUtil_StrChr( s, '\r', size ) );
+        }
+        tcb = nsPerCall( t0, BENCH_ROUNDS );
+        printf( "%3zu bytes : StrLen %.1f ns, BufStrLen %.1f ns, StrChr %.1f ns, BufStrChr %.1f ns\n", size, tb, tw, tcb, tc );
+    }
+    (void)sink;
+
+    return ( 0uL == failed )? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,156 @@
+/*
+Host simulation of the soft_pwm compare mode (SFPWM_BankNextEdge) driven by a
+16-bit free running timer : the isr fires when TCNT matches OCR, runs with a
+random latency below SFPWM_MIN_EDGE_TICKS and does OCR += SFPWM_BankNextEdge().
+
+An 8-channel bank is reconfigured 2000 times with random duties and phases,
+many of them with pulses and edge gaps shorter than SFPWM_MIN_EDGE_TICKS. Once
+the new values are active, every compare match is checked :
+    - the new OCR is still ahead of TCNT when it is written (no missed match),
+    - two matches are never closer than SFPWM_MIN_EDGE_TICKS,
+    - the port holds exactly the ideal levels at the tick of the match,
+    - every ideal edge is served less than SFPWM_MIN_EDGE_TICKS late, so the
+      period never drifts.
+The pulses dropped because both of their edges were deferred to the same 
+match are reported : their level check passes, as the ideal pulse is over.
+*/
+#include "soft_pwm.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SIM_PERIOD          ( 2000u )   /*ticks : the 16-bit timer wraps every 32 periods*/
+#define SIM_RECONFIGS       ( 2000 )
+#define SIM_CHECK_PERIODS   ( 3u )
+
+static unsigned long long rng = 88172645463325252uLL;
+
+static unsigned long long xorshift( void ){
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng;
+}
+
+static unsigned long failed = 0uL;
+
+static void fail( const char *what, unsigned long long t, int ch ){
+    if( ++failed <= 10uL ){
+        printf( "FAIL %s at tick %llu (channel %d)\n", what, t, ch );
+    }
+}
+
+/*ideal level of the channel at the absolute tick <t>*/
+static int level( const SFPWM_bank_t *b, int ch, unsigned long long t ){
+    const unsigned long x = (unsigned long)( t % SIM_PERIOD );
+
+    return ( ( x + SIM_PERIOD - b->phase[ ch ] ) % SIM_PERIOD ) < b->duty[ ch ];
+}
+
+/*number of ideal edges of the channel in (from, to], with to - from <= period. 
+<late> gets the tick of the earliest one, <before> the number of them before <to>*/
+static int edgesIn( const SFPWM_bank_t *b, int ch, unsigned long long from, unsigned long long to, unsigned long long *late, int *before ){
+    const unsigned long tick[ 2 ] = { b->phase[ ch ], ( b->phase[ ch ] + (unsigned long)b->duty[ ch ] ) % SIM_PERIOD };
+    int k, n = 0;
+
+    *late = to;
+    *before = 0;
+    if( ( b->duty[ ch ] > 0u ) && ( b->duty[ ch ] < SIM_PERIOD ) ){
+        for( k = 0 ; k < 2 ; ++k ){
+            const unsigned long long t = from + 1u + ( tick[ k ] + SIM_PERIOD - (unsigned long)( ( from + 1u ) % SIM_PERIOD ) ) % SIM_PERIOD;
+
+            if( t <= to ){
+                ++n;
+                if( t < to ){
+                    ++*before;
+                }
+                if( t < *late ){
+                    *late = t;
+                }
+            }
+        }
+    }
+    return n;
+}
+
+/*random high time : often shorter than SFPWM_MIN_EDGE_TICKS, sometimes 0% or 100%*/
+static uint16_t randomDuty( void ){
+    uint16_t d;
+
+    switch( xorshift() % 8u ){
+        case 0: d = 0u; break;
+        case 1: d = SIM_PERIOD; break;
+        case 2: case 3: d = (uint16_t)( 1u + xorshift() % ( 2u*SFPWM_MIN_EDGE_TICKS ) ); break;
+        default: d = (uint16_t)( xorshift() % SIM_PERIOD ); break;
+    }
+    return d;
+}
+
+int main( void ){
+    static volatile uint8_t port;
+    static SFPWM_bank_t bank;
+    unsigned long long now = 0u, match, last, start, edges = 0u, deferred = 0u, dropped = 0u, checked = 0u, isr = 0u;
+    uint16_t tcnt, ocr;
+    int it, ch;
+
+    SFPWM_BankInit( &bank, &port, 0xFFu, SIM_PERIOD );
+    ocr = SFPWM_BankFirstEdge( &bank ); /*the timer starts at 0*/
+    match = ocr;
+    last = 0u;
+    for( it = 0 ; it < SIM_RECONFIGS ; ++it ){
+        for( ch = 0 ; ch < SFPWM_BANK_CHANNELS ; ++ch ){ /*rising edges clustered around the channel 0 one*/
+            const uint16_t phase = ( 0u == ( xorshift() & 1u ) )? (uint16_t)( xorshift() % SIM_PERIOD )
+                                   : (uint16_t)( ( bank.phase[ 0 ] + xorshift() % ( 2u*SFPWM_MIN_EDGE_TICKS ) ) % SIM_PERIOD );
+
+            SFPWM_BankSetDutyTicks( &bank, (uint8_t)ch, randomDuty() );
+            SFPWM_BankSetPhaseTicks( &bank, (uint8_t)ch, phase );
+        }
+        start = ( last/SIM_PERIOD + 2u )*SIM_PERIOD; /*the new values are active from this boundary on*/
+        while( match < start + SIM_CHECK_PERIODS*SIM_PERIOD ){
+            const unsigned long long latency = xorshift() % SFPWM_MIN_EDGE_TICKS;
+            uint16_t delta;
+
+            now = match; /*compare match*/
+            tcnt = (uint16_t)( now + latency ); /*the isr starts late, the timer keeps running*/
+            delta = SFPWM_BankNextEdge( &bank );
+            ocr = (uint16_t)( ocr + delta );
+            ++isr;
+            if( (uint16_t)( ocr - tcnt ) > delta ){ /*written behind the counter : the next match would be 65536 ticks late*/
+                fail( "OCR behind TCNT", now, -1 );
+            }
+            match = now + delta;
+            if( last >= start ){
+                if( ( now - last ) < SFPWM_MIN_EDGE_TICKS ){
+                    fail( "matches closer than SFPWM_MIN_EDGE_TICKS", now, -1 );
+                }
+                for( ch = 0 ; ch < SFPWM_BANK_CHANNELS ; ++ch ){
+                    unsigned long long e;
+                    int late;
+                    const int n = edgesIn( &bank, ch, last, now, &e, &late );
+
+                    if( ( ( port >> ch ) & 1u ) != (unsigned)level( &bank, ch, now ) ){
+                        fail( "wrong level", now, ch );
+                    }
+                    if( n > 0 ){
+                        edges += (unsigned long long)n;
+                        deferred += (unsigned long long)late;
+                        if( 2 == n ){
+                            ++dropped;
+                        }
+                        if( ( now - e ) >= SFPWM_MIN_EDGE_TICKS ){ /*the earliest one is the latest served*/
+                            fail( "edge served too late", e, ch );
+                        }
+                    }
+                    ++checked;
+                }
+            }
+            last = now;
+        }
+    }
+    printf( "soft_pwm compare mode : %llu isr, %llu edges (%llu deferred, %llu short pulses dropped), %llu level checks, %lu failures\n",
+            isr, edges, deferred, dropped, checked, failed );
+    if( 0u == deferred ){
+        fail( "no deferred edge was exercised", now, -1 );
+    }
+
+    return ( 0uL == failed )? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,160 @@
+/*
+Round-trip accuracy test and benchmark of qIOUtil_AtoF (host build).
+
+Every input is checked bit-exact against the C library strtod, which is 
+correctly rounded on glibc. The exponent notation is parsed only when 
+Q_ATOF_FULL is enabled, so the inputs are written in positional notation.
+*/
+#include "QuarkTS.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ROUNDTRIP_VALUES    ( 200000 )
+#define RANDOM_STRINGS      ( 200000 )
+#define BENCH_ROUNDS        ( 20 )
+
+static unsigned long long rng = 88172645463325252uLL;
+
+static unsigned long long xorshift( void ){
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng;
+}
+
+/*writes <v> (positive) with <sig> significant digits in positional notation*/
+static void positional( double v, int sig, char *out ){
+    char e[ 64 ], digits[ 40 ];
+    int exp10, nd = 0, i, pos = 0;
+    char *p;
+
+    (void)snprintf( e, sizeof(e), "%.*e", sig - 1, v );
+    for( p = e ; 'e' != *p ; ++p ){
+        if( ( *p >= '0' ) && ( *p <= '9' ) ){
+            digits[ nd++ ] = *p;
+        }
+    }
+    exp10 = atoi( p + 1 );
+    if( exp10 < 0 ){
+        out[ pos++ ] = '0';
+        out[ pos++ ] = '.';
+        for( i = -1 ; i > exp10 ; --i ){
+            out[ pos++ ] = '0';
+        }
+        for( i = 0 ; i < nd ; ++i ){
+            out[ pos++ ] = digits[ i ];
+        }
+    }
+    else{
+        for( i = 0 ; ( i < nd ) || ( i <= exp10 ) ; ++i ){
+            if( i == ( exp10 + 1 ) ){
+                out[ pos++ ] = '.';
+            }
+            out[ pos++ ] = ( i < nd )? digits[ i ] : '0';
+        }
+    }
+    out[ pos ] = '\0';
+}
+
+static double random_double( void ){
+    double v;
+    unsigned long long bits;
+
+    do{
+        bits = xorshift() & 0x7FFFFFFFFFFFFFFFuLL;
+        (void)memcpy( &v, &bits, sizeof(v) );
+    }while( ( v != v ) || ( v > 1.7976931348623157e308 ) );
+    return v;
+}
+
+static int check( const char *s, unsigned long *fails ){
+    double a = qIOUtil_AtoF( s ), b = strtod( s, NULL );
+
+    if( 0 != memcmp( &a, &b, sizeof(a) ) ){
+        if( *fails < 10u ){
+            printf( "  mismatch: %.60s%s -> %.17g expected %.17g\n", s, ( strlen( s ) > 60u )? "..." : "", a, b );
+        }
+        ++*fails;
+        return 0;
+    }
+    return 1;
+}
+
+int main( void ){
+    static char buf[ 1200 ];
+    static const char * const edge[] = {
+        "0", "0.0", "1", "3.14159265", "0.1", "0.30000000000000004", "9007199254740993",
+        "9007199254740992.5", "179769313486231570000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+        "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004940656458412465441765687928682213723651",
+        "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002470328229206232720882538",
+        "123456789012345678901234567890", "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124", "1.00000000000000011102230246251565404236316680908203126",
+    };
+    unsigned long i, fails = 0u, total = 0u;
+    int r;
+    clock_t t0;
+    double sink = 0.0, dt_q, dt_c;
+    static char inputs[ 1000 ][ 32 ];
+
+    for( i = 0u ; i < sizeof(edge)/sizeof(edge[0]) ; ++i, ++total ){
+        (void)check( edge[ i ], &fails );
+    }
+    for( i = 0u ; i < ROUNDTRIP_VALUES ; ++i, ++total ){ /*shortest round-trip digits and longer ones*/
+        positional( random_double(), 17, buf );
+        (void)check( buf, &fails );
+    }
+    for( i = 0u ; i < RANDOM_STRINGS ; ++i, ++total ){ /*random digit strings, many of them near halfway points*/
+        int nd = 1 + (int)( xorshift() % 40u ), pt = (int)( xorshift() % (unsigned)( nd + 1 ) ), j, pos = 0;
+
+        for( j = 0 ; j < nd ; ++j ){
+            if( j == pt ){
+                buf[ pos++ ] = '.';
+            }
+            buf[ pos++ ] = (char)( '0' + ( ( j < 16 )? (int)( xorshift() % 10u ) : ( ( 0u == ( i & 1u ) )? 0 : 9 ) ) );
+        }
+        buf[ pos ] = '\0';
+        (void)check( buf, &fails );
+    }
+    printf( "qIOUtil_AtoF round-trip: %lu/%lu bit-exact\n", total - fails, total );
+
+    for( i = 0u ; i < 1000u ; ++i ){ /*typical configuration parameters*/
+        (void)snprintf( inputs[ i ], sizeof(inputs[ i ]), "%.*f", (int)( i % 7u ), ( (double)( xorshift() % 2000000u ) - 1000000.0 )/1000.0 );
+    }
+    t0 = clock();
+    for( r = 0 ; r < BENCH_ROUNDS*100 ; ++r ){
+        for( i = 0u ; i < 1000u ; ++i ){
+            sink += qIOUtil_AtoF( inputs[ i ] );
+        }
+    }
+    dt_q = (double)( clock() - t0 )/CLOCKS_PER_SEC;
+    t0 = clock();
+    for( r = 0 ; r < BENCH_ROUNDS*100 ; ++r ){
+        for( i = 0u ; i < 1000u ; ++i ){
+            sink += strtod( inputs[ i ], NULL );
+        }
+    }
+    dt_c = (double)( clock() - t0 )/CLOCKS_PER_SEC;
+    printf( "parameters: qIOUtil_AtoF %.1f ns/call, strtod %.1f ns/call (%g)\n", 1e9*dt_q/( BENCH_ROUNDS*100000.0 ), 1e9*dt_c/( BENCH_ROUNDS*100000.0 ), sink );
+    for( i = 0u ; i < 1000u ; ++i ){ /*17 significant digits : the slow path*/
+        positional( 1e-3 + (double)( xorshift() % 1000000u ), 17, inputs[ i ] );
+    }
+    sink = 0.0;
+    t0 = clock();
+    for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+        for( i = 0u ; i < 1000u ; ++i ){
+            sink += qIOUtil_AtoF( inputs[ i ] );
+        }
+    }
+    dt_q = (double)( clock() - t0 )/CLOCKS_PER_SEC;
+    t0 = clock();
+    for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+        for( i = 0u ; i < 1000u ; ++i ){
+            sink += strtod( inputs[ i ], NULL );
+        }
+    }
+    dt_c = (double)( clock() - t0 )/CLOCKS_PER_SEC;
+    printf( "17 digits: qIOUtil_AtoF %.1f ns/call, strtod %.1f ns/call (%g)\n", 1e9*dt_q/( BENCH_ROUNDS*1000.0 ), 1e9*dt_c/( BENCH_ROUNDS*1000.0 ), sink );
+    return ( 0u == fails )? EXIT_SUCCESS : EXIT_FAILURE;
+}
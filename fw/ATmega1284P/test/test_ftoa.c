@@ -0,0 +1,107 @@
+/*
+Rounding test and benchmark of qIOUtil_FtoA (host build).
+
+Every finite float is compared against the C library printf("%.*f"), which 
+prints the exact binary value rounded to nearest, ties to even, on glibc. The
+precisions 0 to Q_MAX_FTOA_PRECISION are all checked, 7 to 9 included, where 
+the scaled fraction no longer fits the float mantissa.
+*/
+#include "QuarkTS.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define RANDOM_VALUES       ( 200000 )
+#define HALFWAY_VALUES      ( 100000 )
+#define BENCH_ROUNDS        ( 20 )
+
+static unsigned long long rng = 88172645463325252uLL;
+
+static unsigned long long xorshift( void ){
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng;
+}
+
+static float fromBits( unsigned long u ){
+    float f;
+    qUINT32_t b = (qUINT32_t)u;
+
+    (void)memcpy( &f, &b, sizeof(f) );
+    return f;
+}
+
+static unsigned long checked = 0uL, failed = 0uL;
+
+static void check( float f ){
+    char got[ 64 ], expected[ 80 ];
+    unsigned int p;
+
+    for( p = 0u ; p <= Q_MAX_FTOA_PRECISION ; ++p ){
+        (void)qIOUtil_FtoA( f, got, (qUINT8_t)p );
+        (void)snprintf( expected, sizeof(expected), "%.*f", (int)p, (double)f );
+        ++checked;
+        if( 0 != strcmp( got, expected ) ){
+            if( ++failed <= 10uL ){
+                printf( "FAIL %a p=%u : got %s expected %s\n", (double)f, p, got, expected );
+            }
+        }
+    }
+}
+
+static double seconds( void ){
+    return (double)clock()/CLOCKS_PER_SEC;
+}
+
+int main( void ){
+    static float values[ 4096 ];
+    static const float edges[] = { 0.0f, -0.0f, 0.5f, 1.5f, 2.5f, -2.5f, 0.125f, 0.375f, 9.5f, 99.99999f, 
+                                   0.05f, 0.0005f, 1e-7f, 4294967295.0f, 4294967296.0f, 16777216.0f, 1e10f,
+                                   3.4028235e38f, -3.4028235e38f, 1.17549435e-38f, 1.4e-45f, 123.456f };
+    char buf[ 64 ];
+    double t0, t1, t2;
+    size_t i;
+    int r;
+
+    for( i = 0u ; i < sizeof(edges)/sizeof(edges[0]) ; ++i ){
+        check( edges[ i ] );
+    }
+    for( i = 0u ; i < RANDOM_VALUES ; ++i ){ /*any finite float, the exponent field 255 is skipped*/
+        unsigned long u = (unsigned long)( xorshift() & 0xFFFFFFFFuLL );
+
+        if( 0xFFuL != ( ( u >> 23 ) & 0xFFuL ) ){
+            check( fromBits( u ) );
+        }
+    }
+    for( i = 0u ; i < HALFWAY_VALUES ; ++i ){ /*k/2^n with a few fraction bits : exact ties at some precision*/
+        const unsigned int n = 1u + (unsigned int)( xorshift() % 20u );
+        const float f = (float)( xorshift() % ( 1uLL << 23 ) )/(float)( 1uL << n );
+
+        check( ( 0u != ( xorshift() & 1u ) )? -f : f );
+    }
+    printf( "qIOUtil_FtoA : %lu/%lu match printf\n", checked - failed, checked );
+
+    for( i = 0u ; i < sizeof(values)/sizeof(values[0]) ; ++i ){ /*typical sensor magnitudes*/
+        values[ i ] = (float)( (double)( xorshift() % 2000000u )/1000.0 - 1000.0 );
+    }
+    t0 = seconds();
+    for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+        for( i = 0u ; i < sizeof(values)/sizeof(values[0]) ; ++i ){
+            (void)qIOUtil_FtoA( values[ i ], buf, 6u );
+        }
+    }
+    t1 = seconds();
+    for( r = 0 ; r < BENCH_ROUNDS ; ++r ){
+        for( i = 0u ; i < sizeof(values)/sizeof(values[0]) ; ++i ){
+            (void)snprintf( buf, sizeof(buf), "%.6f", (double)values[ i ] );
+        }
+    }
+    t2 = seconds();
+    printf( "precision 6 : qIOUtil_FtoA %.1f ns, snprintf %.1f ns\n",
+            1e9*( t1 - t0 )/( BENCH_ROUNDS*sizeof(values)/sizeof(values[0]) ),
+            1e9*( t2 - t1 )/( BENCH_ROUNDS*sizeof(values)/sizeof(values[0]) ) );
+
+    return ( 0uL == failed )? EXIT_SUCCESS : EXIT_FAILURE;
+}